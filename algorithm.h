@@ -37,8 +37,10 @@ SOFTWARE.
 #include <iterator>
 #include <utility>
 #include <functional>
+#include <memory>
 
 #include "type_traits.h"
+#include "platform.h"
 
 namespace etl
 {
@@ -465,6 +467,55 @@ namespace etl
 
     return std::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
+
+  //***************************************************************************
+  /// move
+  /// Moves the range if the compiler supports rvalue references, otherwise copies.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/move"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TOutputIterator>
+  TOutputIterator move(TIterator begin, TIterator end, TOutputIterator destination)
+  {
+#if defined(ETL_CPP11_SUPPORTED)
+    return std::move(begin, end, destination);
+#else
+    return std::copy(begin, end, destination);
+#endif
+  }
+
+  //***************************************************************************
+  /// move_backward
+  /// Moves the range if the compiler supports rvalue references, otherwise copies.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/move_backward"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TOutputIterator>
+  TOutputIterator move_backward(TIterator begin, TIterator end, TOutputIterator destination)
+  {
+#if defined(ETL_CPP11_SUPPORTED)
+    return std::move_backward(begin, end, destination);
+#else
+    return std::copy_backward(begin, end, destination);
+#endif
+  }
+
+  //***************************************************************************
+  /// uninitialized_move
+  /// Move constructs the range into uninitialised memory if the compiler
+  /// supports rvalue references, otherwise copy constructs.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/memory/uninitialized_move"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TOutputIterator>
+  TOutputIterator uninitialized_move(TIterator begin, TIterator end, TOutputIterator destination)
+  {
+#if defined(ETL_CPP11_SUPPORTED)
+    return std::uninitialized_copy(std::make_move_iterator(begin), std::make_move_iterator(end), destination);
+#else
+    return std::uninitialized_copy(begin, end, destination);
+#endif
+  }
 }
 
 #endif
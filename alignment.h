@@ -30,6 +30,7 @@ SOFTWARE.
 #define __ETL_ALIGNEMENT__
 
 #include "type_traits.h"
+#include "static_assert.h"
 
 ///\defgroup align_at align_at
 /// Creates a variable of the specified type at the specified alignment.
@@ -104,4 +105,77 @@ namespace etl
 #undef ETL_ALIGNMENT_PRE
 #undef ETL_ALIGNMENT_POST
 
+namespace etl
+{
+  namespace __private_alignment__
+  {
+    //*************************************************************************
+    /// Selects T if it has the required alignment, otherwise TNext.
+    //*************************************************************************
+    template <const size_t ALIGNMENT, typename T, typename TNext>
+    struct select_alignment
+    {
+      typedef typename etl::conditional<etl::alignment_of<T>::value == ALIGNMENT, T, TNext>::type type;
+    };
+
+    /// Terminator for the selection chain.
+    struct no_type_with_alignment
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// Gets a fundamental type with the specified alignment.
+  /// Fails to compile if no such type exists.
+  ///\ingroup alignment
+  //***************************************************************************
+  template <const size_t ALIGNMENT>
+  struct type_with_alignment
+  {
+  private:
+
+    typedef __private_alignment__::no_type_with_alignment none;
+
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, long double, none>::type t9;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, double,      t9>::type   t8;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, float,       t8>::type   t7;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, void*,       t7>::type   t6;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, long long,   t6>::type   t5;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, long,        t5>::type   t4;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, int,         t4>::type   t3;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, short,       t3>::type   t2;
+    typedef typename __private_alignment__::select_alignment<ALIGNMENT, char,        t2>::type   t1;
+
+  public:
+
+    typedef t1 type;
+
+    STATIC_ASSERT((!etl::is_same<type, none>::value), "No type with the requested alignment");
+  };
+
+  //***************************************************************************
+  /// Uninitialised storage of LENGTH bytes at the specified alignment.
+  /// Objects are created in the storage with placement new.
+  /// Under C++11 any alignment the compiler supports may be used, including
+  /// those of over-aligned types. Otherwise it must be that of a fundamental type.
+  ///\ingroup alignment
+  //***************************************************************************
+  template <const size_t LENGTH, const size_t ALIGNMENT>
+  struct aligned_storage
+  {
+#if defined(ETL_CPP11_SUPPORTED)
+    struct type
+    {
+      alignas(ALIGNMENT) char data[LENGTH];
+    };
+#else
+    union type
+    {
+      char data[LENGTH];
+      typename etl::type_with_alignment<ALIGNMENT>::type etl_alignment_type;
+    };
+#endif
+  };
+}
+
 #endif
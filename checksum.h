@@ -34,12 +34,54 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 #include "endian.h"
+#include "smallest.h"
+#include "hash_input.h"
 
 ///\defgroup checksum Checksum calculation
 ///\ingroup maths
 
 namespace etl
 {
+  namespace __private_checksum__
+  {
+    //*************************************************************************
+    /// Sums the bytes of an 8 bit value.
+    //*************************************************************************
+    inline uint32_t byte_sum(uint8_t value)
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// Sums the bytes of a 16 bit value.
+    //*************************************************************************
+    inline uint32_t byte_sum(uint16_t value)
+    {
+      return uint32_t(value & 0xFF) + uint32_t(value >> 8);
+    }
+
+    //*************************************************************************
+    /// Sums the bytes of a 32 bit value, in parallel within the word.
+    //*************************************************************************
+    inline uint32_t byte_sum(uint32_t value)
+    {
+      value = (value & 0x00FF00FF) + ((value >> 8) & 0x00FF00FF);
+
+      return (value & 0xFFFF) + (value >> 16);
+    }
+
+    //*************************************************************************
+    /// Sums the bytes of a 64 bit value, in parallel within the word.
+    //*************************************************************************
+    inline uint32_t byte_sum(uint64_t value)
+    {
+      value = (value & 0x00FF00FF00FF00FFULL) + ((value >> 8)  & 0x00FF00FF00FF00FFULL);
+      value = (value & 0x0000FFFF0000FFFFULL) + ((value >> 16) & 0x0000FFFF0000FFFFULL);
+
+      return uint32_t(value & 0xFFFFFFFF) + uint32_t(value >> 32);
+    }
+  }
+
   //***************************************************************************
   /// Calculates the checksum.
   ///\tparam TSum       The type used for the sum.
@@ -91,20 +133,10 @@ namespace etl
     {
       STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
 
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
+      typedef typename smallest_uint_for_bits<sizeof(TValue) * 8>::type unsigned_t;
+
+      // The sum of the bytes does not depend on their order.
+      sum += value_type(__private_checksum__::byte_sum(static_cast<unsigned_t>(value)));
     }
 
     //*************************************************************************
@@ -123,10 +155,7 @@ namespace etl
     template<typename TIterator>
     void add(TIterator begin, const TIterator end)
     {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -158,6 +187,34 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// As the sum does not depend on byte order, they are read as bytes.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      const uint8_t* p_begin = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* p_end   = reinterpret_cast<const uint8_t*>(end);
+
+      while (p_begin != p_end)
+      {
+        sum += *p_begin++;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
     value_type sum;
   };
 }
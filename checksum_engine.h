@@ -0,0 +1,283 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CHECKSUM_ENGINE__
+#define __ETL_CHECKSUM_ENGINE__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "endian.h"
+
+// Use AVX2 when the compiler is targeting it.
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define ETL_CHECKSUM_AVX2
+#endif
+
+///\ingroup checksum
+
+namespace etl
+{
+  namespace __private_checksum__
+  {
+#if defined(ETL_CHECKSUM_AVX2)
+    //*************************************************************************
+    /// Adds the eight 32 bit lanes of a vector.
+    //*************************************************************************
+    inline uint32_t horizontal_sum(__m256i v)
+    {
+      __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      return uint32_t(_mm_cvtsi128_si32(sum));
+    }
+#endif
+
+    //*************************************************************************
+    /// The Fletcher running sums over bytes, as used by Fletcher-16 and Adler-32.
+    /// sum1 += byte; sum2 += sum1; both modulo MODULUS.
+    /// The sums are only reduced once per block, which is small enough that
+    /// neither can overflow 32 bits (zlib's NMAX, rounded down to 32 bytes).
+    //*************************************************************************
+    template <const uint32_t MODULUS>
+    struct byte_sums
+    {
+      static const size_t BLOCK = 5536;
+
+      static void add(uint32_t& sum1, uint32_t& sum2, const uint8_t* begin, const uint8_t* end)
+      {
+        while (begin != end)
+        {
+          size_t length = size_t(end - begin);
+
+          if (length > BLOCK)
+          {
+            length = BLOCK;
+          }
+
+          add_block(sum1, sum2, begin, length);
+          begin += length;
+
+          sum1 %= MODULUS;
+          sum2 %= MODULUS;
+        }
+      }
+
+    private:
+
+      static void add_block(uint32_t& sum1, uint32_t& sum2, const uint8_t* p, size_t length)
+      {
+#if defined(ETL_CHECKSUM_AVX2)
+        const size_t chunks = length / 32;
+
+        if (chunks != 0)
+        {
+          // Over n bytes, sum2 grows by n * sum1 plus each byte times its distance from the end.
+          const __m256i zero    = _mm256_setzero_si256();
+          const __m256i ones    = _mm256_set1_epi16(1);
+          const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                                   16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1);
+          __m256i v_sum1     = zero;
+          __m256i v_sum2     = zero;
+          __m256i v_previous = zero;
+
+          for (size_t i = 0; i < chunks; ++i)
+          {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+
+            v_previous = _mm256_add_epi32(v_previous, v_sum1);
+            v_sum1     = _mm256_add_epi32(v_sum1, _mm256_sad_epu8(bytes, zero));
+            v_sum2     = _mm256_add_epi32(v_sum2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+            p += 32;
+          }
+
+          v_sum2 = _mm256_add_epi32(v_sum2, _mm256_slli_epi32(v_previous, 5));
+
+          sum2 += (sum1 * uint32_t(chunks * 32)) + horizontal_sum(v_sum2);
+          sum1 += horizontal_sum(v_sum1);
+
+          length -= chunks * 32;
+        }
+#endif
+
+        while (length-- != 0)
+        {
+          sum1 += *p++;
+          sum2 += sum1;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// The Fletcher running sums over little endian 16 bit words, as used by
+    /// Fletcher-32. The length must be even.
+    /// The sums are only reduced once per block, which is small enough that
+    /// neither can overflow 32 bits.
+    //*************************************************************************
+    struct word_sums
+    {
+      static const uint32_t MODULUS = 65535;
+      static const size_t   BLOCK   = 704;
+
+      static void add(uint32_t& sum1, uint32_t& sum2, const uint8_t* begin, const uint8_t* end)
+      {
+        while (begin != end)
+        {
+          size_t length = size_t(end - begin);
+
+          if (length > BLOCK)
+          {
+            length = BLOCK;
+          }
+
+          add_block(sum1, sum2, begin, length);
+          begin += length;
+
+          sum1 %= MODULUS;
+          sum2 %= MODULUS;
+        }
+      }
+
+    private:
+
+      static void add_block(uint32_t& sum1, uint32_t& sum2, const uint8_t* p, size_t length)
+      {
+#if defined(ETL_CHECKSUM_AVX2)
+        const size_t chunks = length / 32;
+
+        if (chunks != 0)
+        {
+          // Each word is split into its low and high bytes, so the signed
+          // 16 bit multiplies never see a value above 255.
+          const __m256i zero      = _mm256_setzero_si256();
+          const __m256i ones      = _mm256_set1_epi16(1);
+          const __m256i low_mask  = _mm256_set1_epi16(0x00FF);
+          const __m256i weights   = _mm256_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+          __m256i v_sum1     = zero;
+          __m256i v_sum2     = zero;
+          __m256i v_previous = zero;
+
+          for (size_t i = 0; i < chunks; ++i)
+          {
+            __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i low   = _mm256_and_si256(words, low_mask);
+            __m256i high  = _mm256_srli_epi16(words, 8);
+
+            v_previous = _mm256_add_epi32(v_previous, v_sum1);
+            v_sum1     = _mm256_add_epi32(v_sum1, _mm256_add_epi32(_mm256_madd_epi16(low, ones),
+                                                                   _mm256_slli_epi32(_mm256_madd_epi16(high, ones), 8)));
+            v_sum2     = _mm256_add_epi32(v_sum2, _mm256_add_epi32(_mm256_madd_epi16(low, weights),
+                                                                   _mm256_slli_epi32(_mm256_madd_epi16(high, weights), 8)));
+            p += 32;
+          }
+
+          v_sum2 = _mm256_add_epi32(v_sum2, _mm256_slli_epi32(v_previous, 4));
+
+          sum2 += (sum1 * uint32_t(chunks * 16)) + horizontal_sum(v_sum2);
+          sum1 += horizontal_sum(v_sum1);
+
+          length -= chunks * 32;
+        }
+#endif
+
+        while (length != 0)
+        {
+          sum1 += uint32_t(p[0]) | (uint32_t(p[1]) << 8);
+          sum2 += sum1;
+          p += 2;
+          length -= 2;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// The ones' complement sum of big endian 16 bit words, folded to 16 bits.
+    /// The length must be even.
+    /// As RFC 1071 shows, the sum does not depend on byte order, so the words
+    /// are summed 32 bits at a time in the native order and the result is
+    /// byte swapped on little endian machines.
+    //*************************************************************************
+    inline uint32_t internet_sum(const uint8_t* p, size_t length)
+    {
+      uint64_t sum = 0;
+
+#if defined(ETL_CHECKSUM_AVX2)
+      const __m256i zero = _mm256_setzero_si256();
+      __m256i v_sum = zero;
+
+      while (length >= 32)
+      {
+        __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+
+        v_sum = _mm256_add_epi64(v_sum, _mm256_add_epi64(_mm256_unpacklo_epi32(words, zero),
+                                                         _mm256_unpackhi_epi32(words, zero)));
+        p      += 32;
+        length -= 32;
+      }
+
+      uint64_t lanes[4];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), v_sum);
+
+      sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+      while (length >= 4)
+      {
+        uint32_t word;
+        memcpy(&word, p, sizeof(word));
+        sum += word;
+        p      += 4;
+        length -= 4;
+      }
+
+      if (length != 0)
+      {
+        uint16_t word;
+        memcpy(&word, p, sizeof(word));
+        sum += word;
+      }
+
+      while ((sum >> 16) != 0)
+      {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+      }
+
+      if (endianness()() == endian::little)
+      {
+        sum = ((sum & 0xFF) << 8) | (sum >> 8);
+      }
+
+      return uint32_t(sum);
+    }
+  }
+}
+
+#endif
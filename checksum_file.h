@@ -0,0 +1,312 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CHECKSUM_FILE__
+#define __ETL_CHECKSUM_FILE__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#if defined(PLATFORM_LINUX) && !defined(ETL_CHECKSUM_FILE_NO_MMAP)
+#define ETL_CHECKSUM_FILE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "exception.h"
+#include "alignment.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
+
+///\defgroup checksum_file Checksum of a file
+/// Feeds the contents of a file to any of the hash or CRC classes.
+/// On Linux the file is memory mapped and handed to the hash as a single
+/// range, so no data is copied. Otherwise, or if the file cannot be mapped,
+/// it is read in large blocks straight into an aligned buffer.
+/// Define ETL_CHECKSUM_FILE_NO_MMAP to always use the read path.
+/// ETL_CHECKSUM_FILE_BUFFER_SIZE sets the size of the default read buffer.
+///\ingroup maths
+
+#ifndef ETL_CHECKSUM_FILE_BUFFER_SIZE
+#define ETL_CHECKSUM_FILE_BUFFER_SIZE 65536
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// Exception base for file checksums
+  //***************************************************************************
+  class checksum_file_exception : public exception
+  {
+  public:
+
+    checksum_file_exception(const char* what)
+      : exception(what)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// The file could not be opened.
+  //***************************************************************************
+  class checksum_file_open_error : public checksum_file_exception
+  {
+  public:
+
+    checksum_file_open_error()
+      : checksum_file_exception("checksum_file: cannot open file")
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// The file could not be read.
+  //***************************************************************************
+  class checksum_file_read_error : public checksum_file_exception
+  {
+  public:
+
+    checksum_file_read_error()
+      : checksum_file_exception("checksum_file: read error")
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// The result of a file checksum.
+  //***************************************************************************
+  template <typename THash>
+  struct checksum_file_result
+  {
+    typedef typename THash::value_type value_type;
+
+    value_type value;   ///< The hash of the file.
+    uint64_t   bytes;   ///< The number of bytes hashed.
+    double     seconds; ///< The elapsed time.
+    bool       mapped;  ///< <b>true</b> if the file was memory mapped.
+
+    //*************************************************************************
+    /// The throughput in bytes per second.
+    /// Returns 0 if the elapsed time was too short to measure.
+    //*************************************************************************
+    double bytes_per_second() const
+    {
+      return (seconds > 0.0) ? double(bytes) / seconds : 0.0;
+    }
+  };
+
+  namespace __private_checksum_file__
+  {
+    //*************************************************************************
+    /// Reports an error.
+    //*************************************************************************
+    template <typename TException>
+    void error()
+    {
+#ifdef ETL_THROW_EXCEPTIONS
+      throw TException();
+#else
+      error_handler::error(TException());
+#endif
+    }
+
+    //*************************************************************************
+    /// Gets a time stamp in seconds.
+    //*************************************************************************
+    inline double now()
+    {
+#if defined(PLATFORM_LINUX)
+      timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      return double(ts.tv_sec) + (double(ts.tv_nsec) * 1e-9);
+#else
+      return double(clock()) / CLOCKS_PER_SEC;
+#endif
+    }
+
+#if defined(ETL_CHECKSUM_FILE_MMAP)
+    //*************************************************************************
+    /// Hashes a regular file through a read only mapping.
+    /// Returns <b>false</b> if the file could not be mapped.
+    //*************************************************************************
+    template <typename THash>
+    bool add_mapped(THash& hash, const char* path, uint64_t& bytes)
+    {
+      int fd = open(path, O_RDONLY);
+
+      if (fd < 0)
+      {
+        return false;
+      }
+
+      struct stat info;
+
+      if ((fstat(fd, &info) != 0) || !S_ISREG(info.st_mode) || (info.st_size <= 0) ||
+          (uint64_t(info.st_size) > uint64_t(size_t(~size_t(0)))))
+      {
+        close(fd);
+        return false;
+      }
+
+      size_t length = size_t(info.st_size);
+      void*  p      = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+
+      if (p == MAP_FAILED)
+      {
+        return false;
+      }
+
+      madvise(p, length, MADV_SEQUENTIAL);
+
+      const uint8_t* begin = static_cast<const uint8_t*>(p);
+      hash.add(begin, begin + length);
+
+      munmap(p, length);
+
+      bytes = length;
+
+      return true;
+    }
+#endif
+
+    //*************************************************************************
+    /// Hashes a file by reading it into the buffer, block by block.
+    //*************************************************************************
+    template <typename THash>
+    void add_read(THash& hash, const char* path, uint8_t* buffer, size_t length, uint64_t& bytes)
+    {
+      FILE* file = fopen(path, "rb");
+
+      if (file == 0)
+      {
+        error<checksum_file_open_error>();
+        return;
+      }
+
+      // The blocks are read straight into our buffer; stdio's own buffer would only add a copy.
+      setvbuf(file, 0, _IONBF, 0);
+
+      size_t count;
+
+      while ((count = fread(buffer, 1, length, file)) > 0)
+      {
+        hash.add(buffer, buffer + count);
+        bytes += count;
+      }
+
+      bool failed = (ferror(file) != 0);
+      fclose(file);
+
+      if (failed)
+      {
+        error<checksum_file_read_error>();
+      }
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// Calculates the hash of a file, reading it through the supplied buffer.
+  /// The file is never memory mapped.
+  /// If ETL_THROW_EXCEPTIONS is defined, throws a checksum_file_open_error if
+  /// the file cannot be opened or a checksum_file_read_error if reading fails.
+  ///\param path   The file name.
+  ///\param buffer The read buffer.
+  ///\param length The length of the read buffer.
+  //***************************************************************************
+  template <typename THash>
+  checksum_file_result<THash> checksum_file(const char* path, uint8_t* buffer, size_t length)
+  {
+    THash hash;
+    checksum_file_result<THash> result;
+
+    result.bytes  = 0;
+    result.mapped = false;
+
+    double start = __private_checksum_file__::now();
+    __private_checksum_file__::add_read(hash, path, buffer, length, result.bytes);
+    result.seconds = __private_checksum_file__::now() - start;
+    result.value   = hash.value();
+
+    return result;
+  }
+
+  //***************************************************************************
+  ///\ingroup checksum_file
+  /// Calculates the hash of a file.
+  /// Regular files are memory mapped where supported, otherwise the file is
+  /// read through a buffer of ETL_CHECKSUM_FILE_BUFFER_SIZE bytes on the stack.
+  /// If ETL_THROW_EXCEPTIONS is defined, throws a checksum_file_open_error if
+  /// the file cannot be opened or a checksum_file_read_error if reading fails.
+  ///\param path The file name.
+  //***************************************************************************
+  template <typename THash>
+  checksum_file_result<THash> checksum_file(const char* path)
+  {
+#if defined(ETL_CHECKSUM_FILE_MMAP)
+    THash hash;
+    checksum_file_result<THash> result;
+
+    result.bytes = 0;
+
+    double start = __private_checksum_file__::now();
+    result.mapped = __private_checksum_file__::add_mapped(hash, path, result.bytes);
+
+    if (result.mapped)
+    {
+      result.seconds = __private_checksum_file__::now() - start;
+      result.value   = hash.value();
+
+      return result;
+    }
+#endif
+
+#if !defined(COMPILER_IAR)
+    etl::align_at<uint8_t[ETL_CHECKSUM_FILE_BUFFER_SIZE], 16> buffer;
+
+    return checksum_file<THash>(path, buffer.value, ETL_CHECKSUM_FILE_BUFFER_SIZE);
+#else
+    uint8_t buffer[ETL_CHECKSUM_FILE_BUFFER_SIZE];
+
+    return checksum_file<THash>(path, buffer, ETL_CHECKSUM_FILE_BUFFER_SIZE);
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,520 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CONCURRENT_POOL__
+#define __ETL_CONCURRENT_POOL__
+
+#include "platform.h"
+
+// Needs std::atomic.
+#if defined(ETL_CPP11_SUPPORTED)
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "ipool.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
+
+//*****************************************************************************
+///\defgroup concurrent_pool concurrent_pool
+/// A fixed capacity pool that may be shared between threads without a lock.
+/// Requires C++11.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //*************************************************************************
+  /// The size independent base of a concurrent pool.
+  /// Free items form a singly linked list of indexes. The head holds the
+  /// index of the first free item and a tag that changes on every update,
+  /// so a compare and swap can not succeed on a head that has been popped
+  /// and pushed back by another thread in the meantime (the ABA problem).
+  /// The head is 64 bits, so the pool is only lock-free on targets with
+  /// lock-free 64 bit atomics.
+  ///\ingroup concurrent_pool
+  //*************************************************************************
+  template <typename T>
+  class iconcurrent_pool
+  {
+  public:
+
+    //*************************************************************************
+    /// A per-thread cache of free items, so that a thread that allocates and
+    /// releases repeatedly rarely touches the shared list.
+    /// A cache must only be used by one thread. Items held by a cache are
+    /// counted as allocated by the pool. The cache returns them when it is
+    /// destroyed or flushed.
+    ///\tparam CACHE_SIZE The maximum number of items held by the cache.
+    //*************************************************************************
+    template <const size_t CACHE_SIZE>
+    class cache
+    {
+    public:
+
+      STATIC_ASSERT(CACHE_SIZE >= 2, "Cache size must be at least 2");
+
+      //*********************************************************************
+      /// Constructor.
+      ///\param pool The pool to cache items from.
+      //*********************************************************************
+      explicit cache(iconcurrent_pool& pool)
+        : pool(pool),
+          count(0)
+      {
+      }
+
+      //*********************************************************************
+      /// Destructor. Returns the cached items to the pool.
+      //*********************************************************************
+      ~cache()
+      {
+        flush();
+      }
+
+      //*********************************************************************
+      /// Allocate an object, refilling the cache from the pool when it is empty.
+      /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
+      /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+      /// \note The object returned is not constructed.
+      //*********************************************************************
+      T* allocate()
+      {
+        if (count == 0)
+        {
+          // Take up to half a cache, so that a following release does not
+          // immediately overflow it.
+          while (count < (CACHE_SIZE / 2))
+          {
+            const uint32_t index = pool.pop_free_index();
+
+            if (index == NO_INDEX)
+            {
+              break;
+            }
+
+            items[count++] = pool.p_buffer + index;
+          }
+
+          if (count == 0)
+          {
+            // Let the pool report the error.
+            return pool.allocate();
+          }
+        }
+
+        return items[--count];
+      }
+
+      //*********************************************************************
+      /// Allocate and construct an object.
+      ///\param args The arguments to construct the object with.
+      //*********************************************************************
+      template <typename ... Args>
+      T* create(Args&& ... args)
+      {
+        T* p = allocate();
+
+        if (p != nullptr)
+        {
+          // Give the item back if the constructor throws.
+          __private_pool__::release_guard<cache, T> guard(*this, p);
+          ::new (p) T(std::forward<Args>(args)...);
+          guard.dismiss();
+        }
+
+        return p;
+      }
+
+      //*********************************************************************
+      /// Destroy an object and release it to the cache.
+      //*********************************************************************
+      void destroy(const T* const p_object)
+      {
+        if (pool.is_in_pool(p_object))
+        {
+          p_object->~T();
+        }
+
+        release(p_object);
+      }
+
+      //*********************************************************************
+      /// Release an object to the cache, passing half the cache back to the
+      /// pool when it is full.
+      /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to the
+      /// pool then an etl::pool_object_not_in_pool is thrown.
+      //*********************************************************************
+      void release(const T* const p_object)
+      {
+        if (!pool.is_in_pool(p_object))
+        {
+          // Let the pool report the error.
+          pool.release(p_object);
+          return;
+        }
+
+        if (count == CACHE_SIZE)
+        {
+          while (count > (CACHE_SIZE / 2))
+          {
+            pool.push_free_index(pool.index_of(items[--count]));
+          }
+        }
+
+        items[count++] = const_cast<T*>(p_object);
+      }
+
+      //*********************************************************************
+      /// Returns all of the cached items to the pool.
+      //*********************************************************************
+      void flush()
+      {
+        while (count > 0)
+        {
+          pool.push_free_index(pool.index_of(items[--count]));
+        }
+      }
+
+      //*********************************************************************
+      /// The number of items held by the cache.
+      //*********************************************************************
+      size_t size() const
+      {
+        return count;
+      }
+
+    private:
+
+      // Disabled.
+      cache(const cache&);
+      cache& operator =(const cache&);
+
+      iconcurrent_pool& pool;
+      T*                items[CACHE_SIZE];
+      size_t            count;
+    };
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// \note The object returned is not constructed.
+    //*************************************************************************
+    T* allocate()
+    {
+      const uint32_t index = pop_free_index();
+
+      if (index != NO_INDEX)
+      {
+        return p_buffer + index;
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw pool_no_allocation();
+#else
+        error_handler::error(pool_no_allocation());
+#endif
+        return nullptr;
+      }
+    }
+
+    //*************************************************************************
+    /// Allocate and construct an object from the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    ///\param args The arguments to construct the object with.
+    //*************************************************************************
+    template <typename ... Args>
+    T* create(Args&& ... args)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<iconcurrent_pool, T> guard(*this, p);
+        ::new (p) T(std::forward<Args>(args)...);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Destroy an object created with create() and release it to the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void destroy(const T* const p_object)
+    {
+      if (is_in_pool(p_object))
+      {
+        p_object->~T();
+      }
+
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Free an object in the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \note The object is not destroyed.
+    //*************************************************************************
+    void release(const T& object)
+    {
+      release(&object);
+    }
+
+    //*************************************************************************
+    /// Free an object in the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \note The object is not destroyed.
+    //*************************************************************************
+    void release(const T* const p_object)
+    {
+      if (is_in_pool(p_object))
+      {
+        push_free_index(index_of(p_object));
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw pool_object_not_in_pool();
+#else
+        error_handler::error(pool_object_not_in_pool());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    //*************************************************************************
+    bool is_in_pool(const T& object) const
+    {
+      return is_in_pool(&object);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    //*************************************************************************
+    bool is_in_pool(const T* const p_object) const
+    {
+      typename std::iterator_traits<T*>::difference_type distance = p_object - p_buffer;
+
+      return ((distance >= 0) && (distance < static_cast<typename std::iterator_traits<T*>::difference_type>(MAX_SIZE)));
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// The value may be out of date as soon as it is returned.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - items_allocated.load(std::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// The value may be out of date as soon as it is returned.
+    //*************************************************************************
+    bool empty() const
+    {
+      return available() == 0;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    /// The derived class calls initialise() once its storage is constructed.
+    //*************************************************************************
+    iconcurrent_pool(T* p_buffer, std::atomic<uint32_t>* p_next, size_t size)
+      : p_buffer(p_buffer),
+        p_next(p_next),
+        items_allocated(0),
+        MAX_SIZE(size)
+    {
+    }
+
+    //*************************************************************************
+    /// Links all of the items in to the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0; i < MAX_SIZE; ++i)
+      {
+        p_next[i].store(uint32_t(i + 1), std::memory_order_relaxed);
+      }
+
+      if (MAX_SIZE > 0)
+      {
+        p_next[MAX_SIZE - 1].store(NO_INDEX, std::memory_order_relaxed);
+      }
+
+      free_head.store(make_head(0, (MAX_SIZE > 0) ? 0 : NO_INDEX), std::memory_order_release);
+    }
+
+  private:
+
+    // Marks the end of the free list.
+    static const uint32_t NO_INDEX = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    /// Makes a head from a tag and an index.
+    //*************************************************************************
+    static uint64_t make_head(uint64_t tag, uint32_t index)
+    {
+      return (tag << 32) | index;
+    }
+
+    //*************************************************************************
+    /// Gets the index of an object in the pool.
+    //*************************************************************************
+    uint32_t index_of(const T* const p_object) const
+    {
+      return static_cast<uint32_t>(p_object - p_buffer);
+    }
+
+    //*************************************************************************
+    /// Pops the first free index, or NO_INDEX if there are none.
+    //*************************************************************************
+    uint32_t pop_free_index()
+    {
+      uint64_t head = free_head.load(std::memory_order_acquire);
+
+      for (;;)
+      {
+        const uint32_t index = static_cast<uint32_t>(head);
+
+        if (index == NO_INDEX)
+        {
+          return NO_INDEX;
+        }
+
+        // If another thread takes this item first, 'next' may be stale, but
+        // the tag will have changed and the exchange will fail.
+        const uint32_t next     = p_next[index].load(std::memory_order_relaxed);
+        const uint64_t new_head = make_head((head >> 32) + 1, next);
+
+        if (free_head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire))
+        {
+          items_allocated.fetch_add(1, std::memory_order_relaxed);
+          return index;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a free index on to the front of the list.
+    //*************************************************************************
+    void push_free_index(uint32_t index)
+    {
+      items_allocated.fetch_sub(1, std::memory_order_relaxed);
+
+      uint64_t head = free_head.load(std::memory_order_relaxed);
+      uint64_t new_head;
+
+      do
+      {
+        p_next[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = make_head((head >> 32) + 1, index);
+      } while (!free_head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Disabled.
+    iconcurrent_pool(const iconcurrent_pool&);
+    iconcurrent_pool& operator =(const iconcurrent_pool&);
+
+    T* const               p_buffer;        ///< The pool of objects.
+    std::atomic<uint32_t>* p_next;          ///< The free list links, one per item.
+    std::atomic<uint64_t>  free_head;       ///< The tag and index of the first free item.
+    char                   padding[ETL_CACHE_LINE_SIZE]; ///< Keeps the head and the count on separate cache lines.
+    std::atomic<size_t>    items_allocated; ///< The number of items allocated.
+    const size_t           MAX_SIZE;        ///< The maximum number of objects that can be allocated.
+  };
+
+  //*************************************************************************
+  /// A fixed size pool that may be shared between threads without a lock.
+  /// Items are not constructed until they are created.
+  /// \note Objects still in use when the pool is destroyed are not destroyed.
+  ///\ingroup concurrent_pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class concurrent_pool : public iconcurrent_pool<T>
+  {
+  public:
+
+    static const size_t SIZE = SIZE_;
+
+    STATIC_ASSERT(SIZE < 0xFFFFFFFFUL, "Too many items for a concurrent_pool");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    concurrent_pool()
+      : iconcurrent_pool<T>(reinterpret_cast<T*>(&buffer), next, SIZE)
+    {
+      // The links are members of this class, so are not constructed until
+      // after the base class.
+      this->initialise();
+    }
+
+  private:
+
+    /// The storage for the pool of objects.
+    typename etl::aligned_storage<sizeof(T) * SIZE, etl::alignment_of<T>::value>::type buffer;
+
+    std::atomic<uint32_t> next[SIZE]; ///< The free list links.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,583 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CRC__
+#define __ETL_CRC__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "static_assert.h"
+#include "type_traits.h"
+#include "endian.h"
+#include "smallest.h"
+#include "crc_combine.h"
+#include "hash_input.h"
+
+///\defgroup crc_generic Generic CRC calculation
+/// A CRC defined by the Rocksoft model parameters.
+/// The lookup tables are generated by the compiler and only exist for the
+/// CRCs that are actually used.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// Policy selecting a single 256 entry table.
+  /// Processes one byte per table lookup.
+  /// \ingroup crc_generic
+  //***************************************************************************
+  struct crc_slice_by_1
+  {
+  };
+
+  //***************************************************************************
+  /// Policy selecting the slicing-by-8 tables.
+  /// Processes eight bytes per iteration when the input is a contiguous range
+  /// of bytes. Requires eight times the table space of crc_slice_by_1.
+  /// \ingroup crc_generic
+  //***************************************************************************
+  struct crc_slice_by_8
+  {
+  };
+
+  namespace __private_crc__
+  {
+    //*************************************************************************
+    /// A mask of the lower BITS bits.
+    //*************************************************************************
+    template <const size_t BITS>
+    struct bit_mask
+    {
+      static const uint64_t value = ((uint64_t(1) << (BITS - 1)) << 1) - 1;
+    };
+
+    //*************************************************************************
+    /// Reverses the lower BITS bits of VALUE at compile time.
+    //*************************************************************************
+    template <const uint64_t VALUE, const size_t BITS>
+    struct reflect_bits
+    {
+      static const uint64_t value = ((VALUE & 1) << (BITS - 1)) | reflect_bits<(VALUE >> 1), BITS - 1>::value;
+    };
+
+    template <const uint64_t VALUE>
+    struct reflect_bits<VALUE, 0>
+    {
+      static const uint64_t value = 0;
+    };
+
+    //*************************************************************************
+    /// Reverses the lower 'bits' bits of 'value' at run time.
+    //*************************************************************************
+    template <typename T>
+    T reflect(T value, size_t bits)
+    {
+      T result = 0;
+
+      for (size_t i = 0; i < bits; ++i)
+      {
+        result = T((result << 1) | (value & 1));
+        value >>= 1;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The CRC shift register.
+    /// The register is a whole number of bytes wide.
+    /// A reflected register holds the CRC in its lower bits, reversed.
+    /// A normal register holds the CRC in its upper bits.
+    //*************************************************************************
+    template <const size_t WIDTH_, const uint64_t POLYNOMIAL_, const bool REFLECTED_>
+    struct crc_register
+    {
+      STATIC_ASSERT((WIDTH_ > 0) && (WIDTH_ <= 64), "CRC width must be 1 to 64 bits");
+
+      typedef typename smallest_uint_for_bits<WIDTH_>::type value_type;
+
+      static const size_t   WIDTH      = WIDTH_;
+      static const uint64_t POLYNOMIAL = POLYNOMIAL_;
+      static const bool     REFLECTED  = REFLECTED_;
+      static const size_t   BITS       = ((WIDTH + 7) / 8) * 8;
+      static const size_t   BYTES      = BITS / 8;
+      static const size_t   SHIFT      = REFLECTED ? 0 : BITS - WIDTH;
+      static const uint64_t MASK       = bit_mask<BITS>::value;
+      static const uint64_t POLY       = REFLECTED ? reflect_bits<POLYNOMIAL, WIDTH>::value : ((POLYNOMIAL << SHIFT) & MASK);
+    };
+
+    //*************************************************************************
+    /// Shifts one bit through the register.
+    //*************************************************************************
+    template <typename TRegister, const uint64_t VALUE, const bool REFLECTED = TRegister::REFLECTED>
+    struct bit_step
+    {
+      static const uint64_t value = ((VALUE & 1) != 0) ? ((VALUE >> 1) ^ TRegister::POLY) : (VALUE >> 1);
+    };
+
+    template <typename TRegister, const uint64_t VALUE>
+    struct bit_step<TRegister, VALUE, false>
+    {
+      static const uint64_t value = (((VALUE >> (TRegister::BITS - 1)) & 1) != 0) ? (((VALUE << 1) ^ TRegister::POLY) & TRegister::MASK)
+                                                                                   : ((VALUE << 1) & TRegister::MASK);
+    };
+
+    //*************************************************************************
+    /// Shifts eight bits through the register.
+    //*************************************************************************
+    template <typename TRegister, const uint64_t VALUE, const int STEPS = 8>
+    struct byte_step
+    {
+      static const uint64_t value = byte_step<TRegister, bit_step<TRegister, VALUE>::value, STEPS - 1>::value;
+    };
+
+    template <typename TRegister, const uint64_t VALUE>
+    struct byte_step<TRegister, VALUE, 0>
+    {
+      static const uint64_t value = VALUE;
+    };
+
+    //*************************************************************************
+    /// Entry INDEX of lookup table TABLE.
+    /// Table 0 is the CRC of the byte INDEX.
+    /// Table n is the CRC of the byte INDEX followed by n zero bytes.
+    //*************************************************************************
+    template <typename TRegister, const size_t TABLE, const size_t INDEX>
+    struct table_entry;
+
+    template <typename TRegister, const uint64_t PREVIOUS, const bool REFLECTED = TRegister::REFLECTED>
+    struct next_table_entry
+    {
+      static const uint64_t value = (PREVIOUS >> 8) ^ table_entry<TRegister, 0, (PREVIOUS & 0xFF)>::value;
+    };
+
+    template <typename TRegister, const uint64_t PREVIOUS>
+    struct next_table_entry<TRegister, PREVIOUS, false>
+    {
+      static const uint64_t value = ((PREVIOUS << 8) & TRegister::MASK) ^ table_entry<TRegister, 0, ((PREVIOUS >> (TRegister::BITS - 8)) & 0xFF)>::value;
+    };
+
+    template <typename TRegister, const size_t TABLE, const size_t INDEX>
+    struct table_entry
+    {
+      static const uint64_t value = next_table_entry<TRegister, table_entry<TRegister, TABLE - 1, INDEX>::value>::value;
+    };
+
+    template <typename TRegister, const size_t INDEX>
+    struct table_entry<TRegister, 0, INDEX>
+    {
+      static const uint64_t value = byte_step<TRegister, (TRegister::REFLECTED ? uint64_t(INDEX) : (uint64_t(INDEX) << (TRegister::BITS - 8)))>::value;
+    };
+
+    //*************************************************************************
+    /// Lookup table TABLE for the register.
+    //*************************************************************************
+    template <typename TRegister, const size_t TABLE>
+    struct table
+    {
+      static const typename TRegister::value_type values[256];
+    };
+
+#define ETL_CRC_ENTRY(i)      typename TRegister::value_type(table_entry<TRegister, TABLE, (i)>::value)
+#define ETL_CRC_ENTRIES_4(i)  ETL_CRC_ENTRY(i),          ETL_CRC_ENTRY(i + 1),       ETL_CRC_ENTRY(i + 2),       ETL_CRC_ENTRY(i + 3)
+#define ETL_CRC_ENTRIES_16(i) ETL_CRC_ENTRIES_4(i),      ETL_CRC_ENTRIES_4(i + 4),   ETL_CRC_ENTRIES_4(i + 8),   ETL_CRC_ENTRIES_4(i + 12)
+#define ETL_CRC_ENTRIES_64(i) ETL_CRC_ENTRIES_16(i),     ETL_CRC_ENTRIES_16(i + 16), ETL_CRC_ENTRIES_16(i + 32), ETL_CRC_ENTRIES_16(i + 48)
+
+    template <typename TRegister, const size_t TABLE>
+    const typename TRegister::value_type table<TRegister, TABLE>::values[256] =
+    {
+      ETL_CRC_ENTRIES_64(0), ETL_CRC_ENTRIES_64(64), ETL_CRC_ENTRIES_64(128), ETL_CRC_ENTRIES_64(192)
+    };
+
+#undef ETL_CRC_ENTRY
+#undef ETL_CRC_ENTRIES_4
+#undef ETL_CRC_ENTRIES_16
+#undef ETL_CRC_ENTRIES_64
+
+    //*************************************************************************
+    /// Updates the register with a single byte.
+    //*************************************************************************
+    template <typename TRegister>
+    typename TRegister::value_type add_byte(typename TRegister::value_type crc, uint8_t value)
+    {
+      typedef typename TRegister::value_type value_type;
+
+      if (TRegister::REFLECTED)
+      {
+        return value_type((crc >> 8) ^ table<TRegister, 0>::values[(crc ^ value) & 0xFF]);
+      }
+      else
+      {
+        return value_type(((crc << 8) & TRegister::MASK) ^ table<TRegister, 0>::values[((crc >> (TRegister::BITS - 8)) ^ value) & 0xFF]);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the byte of the register that is combined with the n'th of the
+    /// next input bytes, or zero if the register is narrower than that.
+    //*************************************************************************
+    template <typename TRegister>
+    uint8_t register_byte(typename TRegister::value_type crc, size_t n)
+    {
+      if (n >= TRegister::BYTES)
+      {
+        return 0;
+      }
+      else if (TRegister::REFLECTED)
+      {
+        return uint8_t(crc >> (8 * n));
+      }
+      else
+      {
+        return uint8_t(crc >> (TRegister::BITS - 8 - (8 * n)));
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the part of the register that remains after n bytes have been
+    /// shifted out of it.
+    //*************************************************************************
+    template <typename TRegister>
+    typename TRegister::value_type register_remainder(typename TRegister::value_type crc, size_t n)
+    {
+      typedef typename TRegister::value_type value_type;
+
+      if (n >= TRegister::BYTES)
+      {
+        return 0;
+      }
+      else if (TRegister::REFLECTED)
+      {
+        return value_type(crc >> (8 * n));
+      }
+      else
+      {
+        return value_type((crc << (8 * n)) & TRegister::MASK);
+      }
+    }
+
+    //*************************************************************************
+    /// Range engine. Default uses the single table.
+    //*************************************************************************
+    template <typename TRegister, typename TPolicy>
+    struct engine
+    {
+      typedef typename TRegister::value_type value_type;
+
+      static value_type add(value_type crc, uint8_t value)
+      {
+        return add_byte<TRegister>(crc, value);
+      }
+
+      static value_type add(value_type crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (begin != end)
+        {
+          crc = add_byte<TRegister>(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+
+    //*************************************************************************
+    /// Range engine using the slicing-by-8 tables.
+    //*************************************************************************
+    template <typename TRegister>
+    struct engine<TRegister, crc_slice_by_8>
+    {
+      typedef typename TRegister::value_type value_type;
+
+      static value_type add(value_type crc, uint8_t value)
+      {
+        return add_byte<TRegister>(crc, value);
+      }
+
+      static value_type add(value_type crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while ((end - begin) >= 8)
+        {
+          // As the register is at most 64 bits, all of it is consumed by the eight bytes.
+          crc = value_type(table<TRegister, 7>::values[begin[0] ^ register_byte<TRegister>(crc, 0)] ^
+                           table<TRegister, 6>::values[begin[1] ^ register_byte<TRegister>(crc, 1)] ^
+                           table<TRegister, 5>::values[begin[2] ^ register_byte<TRegister>(crc, 2)] ^
+                           table<TRegister, 4>::values[begin[3] ^ register_byte<TRegister>(crc, 3)] ^
+                           table<TRegister, 3>::values[begin[4] ^ register_byte<TRegister>(crc, 4)] ^
+                           table<TRegister, 2>::values[begin[5] ^ register_byte<TRegister>(crc, 5)] ^
+                           table<TRegister, 1>::values[begin[6] ^ register_byte<TRegister>(crc, 6)] ^
+                           table<TRegister, 0>::values[begin[7] ^ register_byte<TRegister>(crc, 7)]);
+
+          begin += 8;
+        }
+
+        // The first four tables also give a slicing-by-4 step.
+        if ((end - begin) >= 4)
+        {
+          crc = value_type(register_remainder<TRegister>(crc, 4)                           ^
+                           table<TRegister, 3>::values[begin[0] ^ register_byte<TRegister>(crc, 0)] ^
+                           table<TRegister, 2>::values[begin[1] ^ register_byte<TRegister>(crc, 1)] ^
+                           table<TRegister, 1>::values[begin[2] ^ register_byte<TRegister>(crc, 2)] ^
+                           table<TRegister, 0>::values[begin[3] ^ register_byte<TRegister>(crc, 3)]);
+
+          begin += 4;
+        }
+
+        while (begin != end)
+        {
+          crc = add_byte<TRegister>(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Calculates a CRC defined by the Rocksoft model parameters.
+  ///\tparam WIDTH       The width of the CRC in bits. 1 to 64.
+  ///\tparam POLYNOMIAL  The polynomial, without the leading bit.
+  ///\tparam INITIAL     The initial value of the register.
+  ///\tparam REFLECT_IN  If true, the input bytes are reflected.
+  ///\tparam REFLECT_OUT If true, the final register is reflected.
+  ///\tparam XOR_OUT     The value XORed with the final register.
+  ///\tparam ENDIANNESS  The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy     The table policy. crc_slice_by_1, crc_slice_by_8 or crc_hardware (crc_hardware.h). Default = crc_slice_by_1.
+  /// \ingroup crc_generic
+  //***************************************************************************
+  template <const size_t   WIDTH,
+            const uint64_t POLYNOMIAL,
+            const uint64_t INITIAL,
+            const bool     REFLECT_IN,
+            const bool     REFLECT_OUT,
+            const uint64_t XOR_OUT,
+            const int      ENDIANNESS = endian::little,
+            typename       TPolicy    = crc_slice_by_1>
+  class crc
+  {
+  private:
+
+    typedef __private_crc__::crc_register<WIDTH, POLYNOMIAL, REFLECT_IN> register_t;
+    typedef __private_crc__::engine<register_t, TPolicy>                 engine_t;
+
+  public:
+
+    typedef typename register_t::value_type value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc(TIterator begin, const TIterator end)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the CRC to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      crc_register = initial_register();
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the CRC.
+    //*************************************************************************
+    template<typename TValue>
+    void add(TValue value)
+    {
+      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
+
+      // The whole value is passed to the engine, so that multi-byte values
+      // use the same wide path as a range of bytes.
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      crc_register = engine_t::add(crc_register, bytes, bytes + sizeof(TValue));
+    }
+
+    //*************************************************************************
+    /// \param value The uint8_t to add to the CRC.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      crc_register = engine_t::add(crc_register, value);
+    }
+
+    //*************************************************************************
+    /// Contiguous ranges of integral values are passed to the table policy's
+    /// engine as bytes, if their memory order matches ENDIANNESS.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Gets the CRC value.
+    //*************************************************************************
+    value_type value() const
+    {
+      return to_value(crc_register);
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the CRC.
+    //*************************************************************************
+    template<typename TValue>
+    crc& operator +=(TValue value)
+    {
+      add(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks of data.
+    /// \param crc_a    The CRC of the first block.
+    /// \param crc_b    The CRC of the second block.
+    /// \param length_b The length of the second block, in bytes.
+    /// \return The CRC of the first block followed by the second.
+    //*************************************************************************
+    static value_type combine(value_type crc_a, value_type crc_b, size_t length_b)
+    {
+      // Appending the second block's data to the first block's register is the
+      // same as appending the zeros to it and adding the second block's register,
+      // without its initial value.
+      value_type result = value_type(to_register(crc_a) ^ initial_register());
+      result = __private_crc__::add_zeros<value_type>(result, length_b, add_zero_byte);
+
+      return to_value(value_type(result ^ to_register(crc_b)));
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The initial value of the register.
+    //*************************************************************************
+    static value_type initial_register()
+    {
+      return value_type(register_t::REFLECTED ? __private_crc__::reflect_bits<INITIAL, WIDTH>::value
+                                              : ((INITIAL << register_t::SHIFT) & register_t::MASK));
+    }
+
+    //*************************************************************************
+    /// Converts a register to a CRC value.
+    //*************************************************************************
+    static value_type to_value(value_type reg)
+    {
+      value_type result = value_type(reg >> register_t::SHIFT);
+
+      if (REFLECT_IN != REFLECT_OUT)
+      {
+        result = __private_crc__::reflect(result, WIDTH);
+      }
+
+      return value_type(result ^ XOR_OUT);
+    }
+
+    //*************************************************************************
+    /// Converts a CRC value to a register.
+    //*************************************************************************
+    static value_type to_register(value_type value)
+    {
+      value_type result = value_type(value ^ XOR_OUT);
+
+      if (REFLECT_IN != REFLECT_OUT)
+      {
+        result = __private_crc__::reflect(result, WIDTH);
+      }
+
+      return value_type(result << register_t::SHIFT);
+    }
+
+    //*************************************************************************
+    /// Appends a zero byte to the CRC register.
+    //*************************************************************************
+    static value_type add_zero_byte(value_type reg)
+    {
+      return __private_crc__::add_byte<register_t>(reg, 0);
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        crc_register = engine_t::add(crc_register, reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin);
+        ++begin;
+      }
+    }
+
+    value_type crc_register;
+  };
+}
+
+#endif
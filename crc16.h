@@ -29,10 +29,7 @@ SOFTWARE.
 #ifndef __ETL_CRC16__
 #define __ETL_CRC16__
 
-#include <stdint.h>
-
-#include "static_assert.h"
-#include "type_traits.h"
+#include "crc.h"
 #include "endian.h"
 
 ///\defgroup crc16 16 bit CRC calculation
@@ -40,30 +37,24 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC16 table
-  /// \ingroup crc16
-  //***************************************************************************
-  extern const uint16_t CRC16[];
-
   //***************************************************************************
   /// Calculates CRC16 using polynomial 0x8005.
   ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1 or crc_slice_by_8. Default = crc_slice_by_1.
   /// \ingroup crc16
   //***************************************************************************
-  template <const int ENDIANNESS = endian::little>
-  class crc16
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc16 : public crc<16, 0x8005, 0x0000, true, true, 0x0000, ENDIANNESS, TPolicy>
   {
   public:
 
-    typedef uint16_t value_type;
+    typedef crc<16, 0x8005, 0x0000, true, true, 0x0000, ENDIANNESS, TPolicy> base_t;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     crc16()
     {
-      reset();
     }
 
     //*************************************************************************
@@ -73,96 +64,9 @@ namespace etl
     //*************************************************************************
     template<typename TIterator>
     crc16(TIterator begin, const TIterator end)
+      : base_t(begin, end)
     {
-      reset();
-      add(begin, end);
-    }
-
-    //*************************************************************************
-    /// Resets the CRC to the initial state.
-    //*************************************************************************
-    void reset()
-    {
-      crc = 0;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    void add(TValue value)
-    {
-      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
-
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-    }
-
-    //*************************************************************************
-    /// \param value The uint8_t to add to the CRC.
-    /// \return The CRC result.
-    //*************************************************************************
-    void add(uint8_t value)
-    {
-      crc = (crc >> 8) ^ CRC16[(crc ^ value) & 0xFF];
     }
-
-    //*************************************************************************
-    /// \param begin Start of the range.
-    /// \param end   End of the range.
-    //*************************************************************************
-    template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
-    {
-      while (begin != end)
-      {
-        add(*begin);
-        ++begin;
-      }
-    }
-
-    //*************************************************************************
-    /// Gets the CRC value.
-    //*************************************************************************
-    value_type value() const
-    {
-      return crc;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    crc16<ENDIANNESS>& operator +=(TValue value)
-    {
-      add(value);
-
-      return *this;
-    }
-
-    //*************************************************************************
-    /// Conversion operator to value_type.
-    //*************************************************************************
-    operator value_type () const
-    {
-      return crc;
-    }
-
-  private:
-
-    value_type crc;
   };
 }
 
@@ -29,10 +29,7 @@ SOFTWARE.
 #ifndef __etl_crc16_kermit__
 #define __etl_crc16_kermit__
 
-#include <stdint.h>
-
-#include "static_assert.h"
-#include "type_traits.h"
+#include "crc.h"
 #include "endian.h"
 
 ///\defgroup crc16_kermit 16 bit CRC Kermit calculation
@@ -40,30 +37,24 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC Kermit table
-  /// \ingroup crc
-  //***************************************************************************
-  extern const uint16_t CRC_KERMIT[];
-  
   //***************************************************************************
   /// Calculates CRC-Kermit using polynomial 0x1021
   ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1 or crc_slice_by_8. Default = crc_slice_by_1.
   /// \ingroup crc16_kermit
   //***************************************************************************
-  template <const int ENDIANNESS = endian::little>
-  class crc16_kermit
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc16_kermit : public crc<16, 0x1021, 0x0000, true, true, 0x0000, ENDIANNESS, TPolicy>
   {
   public:
 
-    typedef uint16_t value_type;
+    typedef crc<16, 0x1021, 0x0000, true, true, 0x0000, ENDIANNESS, TPolicy> base_t;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     crc16_kermit()
     {
-      reset();
     }
 
     //*************************************************************************
@@ -73,95 +64,9 @@ namespace etl
     //*************************************************************************
     template<typename TIterator>
     crc16_kermit(TIterator begin, const TIterator end)
+      : base_t(begin, end)
     {
-      reset();
-      add(begin, end);
-    }
-
-    //*************************************************************************
-    /// Resets the CRC to the initial state.
-    //*************************************************************************
-    void reset()
-    {
-      crc = 0;
     }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    void add(TValue value)
-    {
-      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
-
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-    }
-
-    //*************************************************************************
-    /// \param value The uint8_t to add to the CRC.
-    //*************************************************************************
-    void add(uint8_t value)
-    {
-      crc = (crc >> 8) ^ CRC_KERMIT[(crc ^ value) & 0xFF];
-    }
-
-    //*************************************************************************
-    /// \param begin Start of the range.
-    /// \param end   End of the range.
-    //*************************************************************************
-    template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
-    {
-      while (begin != end)
-      {
-        add(*begin);
-        ++begin;
-      }
-    }
-
-    //*************************************************************************
-    /// Gets the CRC value.
-    //*************************************************************************
-    value_type value() const
-    {
-      return crc;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    crc16_kermit<ENDIANNESS>& operator +=(TValue value)
-    {
-      add(value);
-
-      return *this;
-    }
-
-    //*************************************************************************
-    /// Conversion operator to value_type
-    //*************************************************************************
-    operator value_type () const
-    {
-      return crc;
-    }
-
-  private:
-
-    value_type crc;
   };
 }
 
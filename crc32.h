@@ -29,10 +29,8 @@ SOFTWARE.
 #ifndef __ETL_CRC32__
 #define __ETL_CRC32__
 
-#include <stdint.h>
-
-#include "static_assert.h"
-#include "type_traits.h"
+#include "crc.h"
+#include "crc_hardware.h"
 #include "endian.h"
 
 ///\defgroup crc32 32 bit CRC calculation
@@ -40,30 +38,24 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC32 table
-  /// \ingroup crc32
-  //***************************************************************************
-  extern const uint32_t CRC32[];
-
   //***************************************************************************
   /// Calculates CRC32 using polynomial 0x04C11DB7.
   ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1, crc_slice_by_8 or crc_hardware. Default = crc_slice_by_1.
   /// \ingroup crc32
   //***************************************************************************
-  template <const int ENDIANNESS = endian::little>
-  class crc32
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc32 : public crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, ENDIANNESS, TPolicy>
   {
   public:
 
-    typedef uint32_t value_type;
+    typedef crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, ENDIANNESS, TPolicy> base_t;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     crc32()
     {
-      reset();
     }
 
     //*************************************************************************
@@ -73,95 +65,9 @@ namespace etl
     //*************************************************************************
     template<typename TIterator>
     crc32(TIterator begin, const TIterator end)
+      : base_t(begin, end)
     {
-      reset();
-      add(begin, end);
-    }
-
-    //*************************************************************************
-    /// Resets the CRC to the initial state.
-    //*************************************************************************
-    void reset()
-    {
-      crc = 0xFFFFFFFF;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    void add(TValue value)
-    {
-      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
-
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-    }
-
-    //*************************************************************************
-    /// \param value The uint8_t to add to the CRC.
-    //*************************************************************************
-    void add(uint8_t value)
-    {
-      crc = (crc >> 8) ^ CRC32[(crc ^ value) & 0xFF];
     }
-
-    //*************************************************************************
-    /// \param begin Start of the range.
-    /// \param end   End of the range.
-    //*************************************************************************
-    template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
-    {
-      while (begin != end)
-      {
-        add(*begin);
-        ++begin;
-      }
-    }
-
-    //*************************************************************************
-    /// Gets the CRC value.
-    //*************************************************************************
-    value_type value() const
-    {
-      return crc ^ 0xFFFFFFFF;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    crc32<ENDIANNESS>& operator +=(TValue value)
-    {
-      add(value);
-
-      return *this;
-    }
-
-    //*************************************************************************
-    /// Conversion operator to value_type.
-    //*************************************************************************
-    operator value_type () const
-    {
-      return crc ^ 0xFFFFFFFF;
-    }
-
-  private:
-
-    value_type crc;
   };
 }
 
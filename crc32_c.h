@@ -0,0 +1,77 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CRC32_C__
+#define __ETL_CRC32_C__
+
+#include <stdint.h>
+
+#include "crc.h"
+#include "crc_hardware.h"
+#include "endian.h"
+
+///\defgroup crc32_c 32 bit CRC calculation (Castagnoli)
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// Calculates CRC32-C using polynomial 0x1EDC6F41 (Castagnoli).
+  /// The crc_hardware policy uses the SSE4.2 CRC32 instruction, if the CPU has it.
+  ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1, crc_slice_by_8 or crc_hardware. Default = crc_slice_by_1.
+  /// \ingroup crc32_c
+  //***************************************************************************
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc32_c : public crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, ENDIANNESS, TPolicy>
+  {
+  public:
+
+    typedef crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, ENDIANNESS, TPolicy> base_t;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_c()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc32_c(TIterator begin, const TIterator end)
+      : base_t(begin, end)
+    {
+    }
+  };
+}
+
+#endif
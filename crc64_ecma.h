@@ -29,10 +29,8 @@ SOFTWARE.
 #ifndef __ETL_CRC64_ECMA__
 #define __ETL_CRC64_ECMA__
 
-#include <stdint.h>
-
-#include "static_assert.h"
-#include "type_traits.h"
+#include "crc.h"
+#include "crc_hardware.h"
 #include "endian.h"
 
 ///\defgroup crc64_ecma 64 bit CRC ECMA calculation
@@ -40,30 +38,24 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC64_ECMA table
-  /// \ingroup crc64_ecma
-  //***************************************************************************
-  extern const uint64_t CRC64_ECMA[];
-
   //***************************************************************************
   /// Calculates CRC64-ECMA using polynomial 0x42F0E1EBA9EA3693.
   ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1, crc_slice_by_8 or crc_hardware. Default = crc_slice_by_1.
   /// \ingroup crc64_ecma
   //***************************************************************************
-  template <const int ENDIANNESS = endian::little>
-  class crc64_ecma
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc64_ecma : public crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, ENDIANNESS, TPolicy>
   {
   public:
 
-    typedef uint64_t value_type;
+    typedef crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, ENDIANNESS, TPolicy> base_t;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     crc64_ecma()
     {
-      reset();
     }
 
     //*************************************************************************
@@ -73,95 +65,9 @@ namespace etl
     //*************************************************************************
     template<typename TIterator>
     crc64_ecma(TIterator begin, const TIterator end)
+      : base_t(begin, end)
     {
-      reset();
-      add(begin, end);
-    }
-
-    //*************************************************************************
-    /// Resets the CRC to the initial state.
-    //*************************************************************************
-    void reset()
-    {
-      crc = 0;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    void add(TValue value)
-    {
-      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
-
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    void add(uint8_t value)
-    {
-      crc = (crc << 8) ^ CRC64_ECMA[((crc >> 56) ^ value) & 0xFF];
     }
-
-    //*************************************************************************
-    /// \param begin Start of the range.
-    /// \param end   End of the range.
-    //*************************************************************************
-    template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
-    {
-      while (begin != end)
-      {
-        add(*begin);
-        ++begin;
-      }
-    }
-
-    //*************************************************************************
-    /// Gets the CRC value.
-    //*************************************************************************
-    value_type value() const
-    {
-      return crc;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    crc64_ecma<ENDIANNESS>& operator +=(TValue value)
-    {
-      add(value);
-
-      return *this;
-    }
-
-    //*************************************************************************
-    /// Conversion operator to value_type.
-    //*************************************************************************
-    operator value_type () const
-    {
-      return crc;
-    }
-
-  private:
-
-    value_type crc;
   };
 }
 
@@ -29,10 +29,7 @@ SOFTWARE.
 #ifndef __ETL_CRC8_CCITT__
 #define __ETL_CRC8_CCITT__
 
-#include <stdint.h>
-
-#include "static_assert.h"
-#include "type_traits.h"
+#include "crc.h"
 #include "endian.h"
 
 ///\defgroup crc8_ccitt 8 bit CRC calculation
@@ -40,30 +37,24 @@ SOFTWARE.
 
 namespace etl
 {
-  //***************************************************************************
-  /// CRC8 table
-  /// \ingroup crc8_ccitt
-  //***************************************************************************
-  extern const uint8_t CRC8_CCITT[];
-
   //***************************************************************************
   /// Calculates CRC8 CCITT using polynomial 0x07.
   ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\tparam TPolicy    The table policy. crc_slice_by_1 or crc_slice_by_8. Default = crc_slice_by_1.
   /// \ingroup crc8_ccitt
   //***************************************************************************
-  template <const int ENDIANNESS = endian::little>
-  class crc8_ccitt
+  template <const int ENDIANNESS = endian::little, typename TPolicy = crc_slice_by_1>
+  class crc8_ccitt : public crc<8, 0x07, 0x00, false, false, 0x00, ENDIANNESS, TPolicy>
   {
   public:
 
-    typedef uint8_t value_type;
+    typedef crc<8, 0x07, 0x00, false, false, 0x00, ENDIANNESS, TPolicy> base_t;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     crc8_ccitt()
     {
-      reset();
     }
 
     //*************************************************************************
@@ -73,94 +64,9 @@ namespace etl
     //*************************************************************************
     template<typename TIterator>
     crc8_ccitt(TIterator begin, const TIterator end)
+      : base_t(begin, end)
     {
-      reset();
-      add(begin, end);
-    }
-
-    //*************************************************************************
-    /// Resets the CRC to the initial state.
-    //*************************************************************************
-    void reset()
-    {
-      crc = 0;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    void add(TValue value)
-    {
-      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
-
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-    }
-
-    //*************************************************************************
-    /// \param value The char to add to the CRC.
-    //*************************************************************************
-    void add(uint8_t value)
-    {
-      crc = CRC8_CCITT[crc ^ value];
     }
-
-    //*************************************************************************
-    /// \param begin Start of the range.
-    /// \param end   End of the range.
-    //*************************************************************************
-    template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
-    {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
-    }
-
-    //*************************************************************************
-    /// Gets the CRC value.
-    //*************************************************************************
-    value_type value() const
-    {
-      return crc;
-    }
-
-    //*************************************************************************
-    /// \param value The value to add to the CRC.
-    //*************************************************************************
-    template<typename TValue>
-    crc8_ccitt<ENDIANNESS>& operator +=(TValue value)
-    {
-      add(value);
-
-      return *this;
-    }
-
-    //*************************************************************************
-    /// Conversion operator to value_type.
-    //*************************************************************************
-    operator value_type () const
-    {
-      return crc;
-    }
-
-  private:
-
-    value_type crc;
   };
 }
 
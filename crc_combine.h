@@ -0,0 +1,123 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CRC_COMBINE__
+#define __ETL_CRC_COMBINE__
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\ingroup crc
+
+namespace etl
+{
+  namespace __private_crc__
+  {
+    //*************************************************************************
+    /// Multiplies a GF(2) matrix by a vector.
+    /// The matrix is stored as one column per bit of T.
+    //*************************************************************************
+    template <typename T>
+    T gf2_matrix_times(const T* matrix, T vector)
+    {
+      T sum = 0;
+
+      while (vector != 0)
+      {
+        if ((vector & 1) != 0)
+        {
+          sum ^= *matrix;
+        }
+
+        vector >>= 1;
+        ++matrix;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Squares a GF(2) matrix.
+    //*************************************************************************
+    template <typename T>
+    void gf2_matrix_square(T* square, const T* matrix)
+    {
+      for (size_t i = 0; i < (sizeof(T) * 8); ++i)
+      {
+        square[i] = gf2_matrix_times(matrix, matrix[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Calculates the effect of appending 'length' zero bytes to a CRC register.
+    /// Takes O(log(length)) matrix squarings.
+    /// \param crc           The CRC register.
+    /// \param length        The number of zero bytes.
+    /// \param add_zero_byte Function that appends a single zero byte to a register.
+    //*************************************************************************
+    template <typename T>
+    T add_zeros(T crc, size_t length, T (*add_zero_byte)(T))
+    {
+      const size_t WIDTH = sizeof(T) * 8;
+
+      // The operator for one zero byte. Column i is the effect on bit i.
+      T op[WIDTH];
+      T square[WIDTH];
+
+      for (size_t i = 0; i < WIDTH; ++i)
+      {
+        op[i] = add_zero_byte(T(T(1) << i));
+      }
+
+      // Apply the operators for each set bit of the length.
+      while (length != 0)
+      {
+        if ((length & 1) != 0)
+        {
+          crc = gf2_matrix_times(op, crc);
+        }
+
+        length >>= 1;
+
+        if (length != 0)
+        {
+          gf2_matrix_square(square, op);
+
+          for (size_t i = 0; i < WIDTH; ++i)
+          {
+            op[i] = square[i];
+          }
+        }
+      }
+
+      return crc;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,444 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_CRC_HARDWARE__
+#define __ETL_CRC_HARDWARE__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crc.h"
+
+// The instructions are compiled in for x86 targets with GCC or Microsoft
+// compilers and are only used if the CPU reports them at run time.
+// Define ETL_CRC_NO_HARDWARE to always use the tables.
+#if !defined(ETL_CRC_NO_HARDWARE)
+  #if defined(COMPILER_GCC) && (defined(__i386__) || defined(__x86_64__))
+    #include <cpuid.h>
+    #include <nmmintrin.h>
+    #include <tmmintrin.h>
+    #include <wmmintrin.h>
+    #define ETL_CRC_HARDWARE
+    #define ETL_CRC_TARGET(features) __attribute__((target(features)))
+  #elif defined(COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+    #include <intrin.h>
+    #define ETL_CRC_HARDWARE
+    #define ETL_CRC_TARGET(features)
+  #endif
+#endif
+
+///\defgroup crc_hardware Hardware CRC calculation
+/// Uses PCLMULQDQ folding for 32 and 64 bit CRCs and the SSE4.2 CRC32
+/// instruction for short ranges of CRC32-C, if the CPU supports them.
+/// The results are identical to those of the tables.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// Policy selecting the CRC instructions of the CPU.
+  /// Falls back to the slicing-by-8 tables for short ranges, single bytes,
+  /// CRCs that the instructions do not cover and CPUs that lack them.
+  /// \ingroup crc_hardware
+  //***************************************************************************
+  struct crc_hardware
+  {
+  };
+
+  namespace __private_crc__
+  {
+    //*************************************************************************
+    /// The ways in which the hardware engine may calculate a CRC.
+    //*************************************************************************
+    struct hardware_method
+    {
+      enum
+      {
+        TABLES,
+        CRC32_INSTRUCTION,
+        CARRY_LESS_MULTIPLY
+      };
+    };
+
+    //*************************************************************************
+    /// Selects the method for the register.
+    /// The CRC32 instruction only calculates CRC32-C, which may also be folded.
+    /// Carry-less multiply folding needs a register with no unused bits.
+    //*************************************************************************
+    template <typename TRegister>
+    struct hardware_method_for
+    {
+#if defined(ETL_CRC_HARDWARE)
+      static const int value = (TRegister::REFLECTED && (TRegister::WIDTH == 32) && (TRegister::POLYNOMIAL == 0x1EDC6F41)) ? hardware_method::CRC32_INSTRUCTION
+                             : ((TRegister::WIDTH == 32) || (TRegister::WIDTH == 64))                                        ? hardware_method::CARRY_LESS_MULTIPLY
+                                                                                                                             : hardware_method::TABLES;
+#else
+      static const int value = hardware_method::TABLES;
+#endif
+    };
+
+    //*************************************************************************
+    /// Hardware engine that only has the tables.
+    //*************************************************************************
+    template <typename TRegister, const int METHOD = hardware_method_for<TRegister>::value>
+    struct hardware_engine : public engine<TRegister, crc_slice_by_8>
+    {
+    };
+
+#if defined(ETL_CRC_HARDWARE)
+    //*************************************************************************
+    /// The CRC instructions that the CPU supports.
+    //*************************************************************************
+    struct cpu_features
+    {
+      bool crc32;
+      bool carry_less_multiply;
+    };
+
+    //*************************************************************************
+    /// Reads the CPU features from CPUID leaf 1.
+    //*************************************************************************
+    inline cpu_features detect_cpu_features()
+    {
+      unsigned int ecx = 0;
+
+#if defined(COMPILER_GCC)
+      unsigned int eax;
+      unsigned int ebx;
+      unsigned int edx;
+
+      if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+      {
+        ecx = 0;
+      }
+#else
+      int info[4];
+      __cpuid(info, 1);
+      ecx = static_cast<unsigned int>(info[2]);
+#endif
+
+      // SSE4.2 is bit 20, SSSE3 is bit 9 and PCLMULQDQ is bit 1.
+      cpu_features features;
+      features.crc32               = (ecx & (1U << 20)) != 0;
+      features.carry_less_multiply = ((ecx & (1U << 9)) != 0) && ((ecx & (1U << 1)) != 0);
+
+      return features;
+    }
+
+    //*************************************************************************
+    /// Gets the CPU features, detecting them on the first call.
+    //*************************************************************************
+    inline const cpu_features& get_cpu_features()
+    {
+      static const cpu_features features = detect_cpu_features();
+
+      return features;
+    }
+
+    //*************************************************************************
+    /// Calculates x^n modulo the polynomial, which is given without its leading bit.
+    //*************************************************************************
+    inline uint64_t x_pow_mod(uint64_t polynomial, size_t width, size_t n)
+    {
+      const uint64_t top  = uint64_t(1) << (width - 1);
+      const uint64_t mask = (top << 1) - 1;
+
+      uint64_t value = 1;
+
+      while (n-- != 0)
+      {
+        const bool carry = (value & top) != 0;
+
+        value = (value << 1) & mask;
+
+        if (carry)
+        {
+          value ^= polynomial;
+        }
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Hardware engine folding 16 byte blocks with PCLMULQDQ.
+    /// Each block is a polynomial X. Folding X over the next D bits replaces it
+    /// with a value congruent to X.x^D, found by multiplying each 64 bit half
+    /// by a constant. The last block is then passed through the tables.
+    /// Reflected registers keep the first byte in the low lane. Normal ones
+    /// are byte reversed so that the first byte is in the high lane.
+    //*************************************************************************
+    template <typename TRegister>
+    struct hardware_engine<TRegister, hardware_method::CARRY_LESS_MULTIPLY> : public engine<TRegister, crc_slice_by_8>
+    {
+      typedef engine<TRegister, crc_slice_by_8> fallback_t;
+      typedef typename TRegister::value_type    value_type;
+
+      using fallback_t::add;
+
+      // Shorter ranges are faster through the tables.
+      static const size_t MINIMUM_LENGTH = 64;
+
+      static value_type add(value_type crc, const uint8_t* begin, const uint8_t* end)
+      {
+        if (((end - begin) >= ptrdiff_t(MINIMUM_LENGTH)) && get_cpu_features().carry_less_multiply)
+        {
+          return add_folded(crc, begin, end);
+        }
+        else
+        {
+          return fallback_t::add(crc, begin, end);
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      /// The multipliers of the low and high lanes for one fold distance.
+      //***********************************************************************
+      struct fold_constant
+      {
+        uint64_t low;
+        uint64_t high;
+      };
+
+      struct fold_constants
+      {
+        fold_constant by_128;
+        fold_constant by_512;
+      };
+
+      //***********************************************************************
+      /// x^n mod P, in the bit order of the lanes.
+      /// A reflected carry-less product is one bit short of a 128 bit
+      /// reflected value, which the exponent makes up for.
+      //***********************************************************************
+      static uint64_t lane_constant(size_t n)
+      {
+        if (TRegister::REFLECTED)
+        {
+          return reflect(x_pow_mod(TRegister::POLYNOMIAL, TRegister::WIDTH, n - 1), 64);
+        }
+        else
+        {
+          return x_pow_mod(TRegister::POLYNOMIAL, TRegister::WIDTH, n);
+        }
+      }
+
+      //***********************************************************************
+      /// The constants for folding over 'distance' bits.
+      /// The low lane holds the first bytes of a reflected block and the last
+      /// bytes of a normal one.
+      //***********************************************************************
+      static fold_constant make_fold_constant(size_t distance)
+      {
+        fold_constant constant;
+
+        constant.low  = lane_constant(TRegister::REFLECTED ? distance + 64 : distance);
+        constant.high = lane_constant(TRegister::REFLECTED ? distance : distance + 64);
+
+        return constant;
+      }
+
+      static fold_constants make_fold_constants()
+      {
+        fold_constants constants;
+
+        constants.by_128 = make_fold_constant(128);
+        constants.by_512 = make_fold_constant(512);
+
+        return constants;
+      }
+
+      static const fold_constants& get_fold_constants()
+      {
+        static const fold_constants constants = make_fold_constants();
+
+        return constants;
+      }
+
+      //***********************************************************************
+      /// Loads a block, with the first byte in the lane that holds the
+      /// register.
+      //***********************************************************************
+      ETL_CRC_TARGET("pclmul,ssse3")
+      static __m128i load(const uint8_t* p)
+      {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+        if (!TRegister::REFLECTED)
+        {
+          block = _mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        return block;
+      }
+
+      //***********************************************************************
+      /// Folds a block over the distance of the constant.
+      //***********************************************************************
+      ETL_CRC_TARGET("pclmul,ssse3")
+      static __m128i fold(__m128i block, __m128i constant)
+      {
+        return _mm_xor_si128(_mm_clmulepi64_si128(block, constant, 0x00),
+                             _mm_clmulepi64_si128(block, constant, 0x11));
+      }
+
+      ETL_CRC_TARGET("pclmul,ssse3")
+      static value_type add_folded(value_type crc, const uint8_t* begin, const uint8_t* end)
+      {
+        const fold_constants& constants = get_fold_constants();
+
+        const __m128i by_128 = _mm_set_epi64x(int64_t(constants.by_128.high), int64_t(constants.by_128.low));
+        const __m128i by_512 = _mm_set_epi64x(int64_t(constants.by_512.high), int64_t(constants.by_512.low));
+
+        // The register is combined with the first bytes of the input.
+        const __m128i initial = TRegister::REFLECTED ? _mm_set_epi64x(0, int64_t(uint64_t(crc)))
+                                                     : _mm_set_epi64x(int64_t(uint64_t(crc) << (64 - TRegister::BITS)), 0);
+
+        // Four independent blocks keep the multiplier busy.
+        __m128i x0 = _mm_xor_si128(load(begin), initial);
+        __m128i x1 = load(begin + 16);
+        __m128i x2 = load(begin + 32);
+        __m128i x3 = load(begin + 48);
+        begin += 64;
+
+        while ((end - begin) >= 64)
+        {
+          x0 = _mm_xor_si128(fold(x0, by_512), load(begin));
+          x1 = _mm_xor_si128(fold(x1, by_512), load(begin + 16));
+          x2 = _mm_xor_si128(fold(x2, by_512), load(begin + 32));
+          x3 = _mm_xor_si128(fold(x3, by_512), load(begin + 48));
+          begin += 64;
+        }
+
+        x0 = _mm_xor_si128(fold(x0, by_128), x1);
+        x0 = _mm_xor_si128(fold(x0, by_128), x2);
+        x0 = _mm_xor_si128(fold(x0, by_128), x3);
+
+        while ((end - begin) >= 16)
+        {
+          x0 = _mm_xor_si128(fold(x0, by_128), load(begin));
+          begin += 16;
+        }
+
+        // The remaining block has the same CRC as all of the input before it.
+        if (!TRegister::REFLECTED)
+        {
+          x0 = _mm_shuffle_epi8(x0, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        uint8_t block[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(block), x0);
+
+        crc = fallback_t::add(value_type(0), block, block + 16);
+
+        return fallback_t::add(crc, begin, end);
+      }
+    };
+
+    //*************************************************************************
+    /// Hardware engine using the SSE4.2 CRC32 instruction.
+    //*************************************************************************
+    template <typename TRegister>
+    struct hardware_engine<TRegister, hardware_method::CRC32_INSTRUCTION> : public engine<TRegister, crc_slice_by_8>
+    {
+      typedef engine<TRegister, crc_slice_by_8> fallback_t;
+
+      using fallback_t::add;
+
+      static uint32_t add(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+        typedef hardware_engine<TRegister, hardware_method::CARRY_LESS_MULTIPLY> folding_engine_t;
+
+        // Each CRC32 instruction waits for the last, so folding is faster for long ranges.
+        if (((end - begin) >= ptrdiff_t(folding_engine_t::MINIMUM_LENGTH)) && get_cpu_features().carry_less_multiply)
+        {
+          return folding_engine_t::add(crc, begin, end);
+        }
+        else if (get_cpu_features().crc32)
+        {
+          return add_crc32(crc, begin, end);
+        }
+        else
+        {
+          return fallback_t::add(crc, begin, end);
+        }
+      }
+
+    private:
+
+      ETL_CRC_TARGET("sse4.2")
+      static uint32_t add_crc32(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+#if defined(__x86_64__) || defined(_M_X64)
+        uint64_t crc64 = crc;
+
+        while ((end - begin) >= 8)
+        {
+          uint64_t value;
+          memcpy(&value, begin, sizeof(value));
+          crc64 = _mm_crc32_u64(crc64, value);
+          begin += 8;
+        }
+
+        crc = uint32_t(crc64);
+#else
+        while ((end - begin) >= 4)
+        {
+          uint32_t value;
+          memcpy(&value, begin, sizeof(value));
+          crc = _mm_crc32_u32(crc, value);
+          begin += 4;
+        }
+#endif
+
+        while (begin != end)
+        {
+          crc = _mm_crc32_u8(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Range engine for the crc_hardware policy.
+    //*************************************************************************
+    template <typename TRegister>
+    struct engine<TRegister, crc_hardware> : public hardware_engine<TRegister>
+    {
+    };
+  }
+}
+
+#undef ETL_CRC_TARGET
+
+#endif
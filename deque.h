@@ -35,6 +35,11 @@ SOFTWARE.
 
 #include "ideque.h"
 #include "container.h"
+#include "ring_index.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
 
 //*****************************************************************************
 ///\defgroup deque deque
@@ -47,6 +52,9 @@ namespace etl
   //***************************************************************************
   /// A fixed capacity double ended queue.
   ///\node The deque allocates one more element than the specified maximum size.
+  /// Indexing wraps around with a single AND only when MAX_SIZE + 1 is a power
+  /// of two, otherwise with a compare. So deque<T, 63> is masked and
+  /// deque<T, 64> is not.
   ///\tparam T         The type of items this deque holds.
   ///\tparam MAX_SIZE_ The capacity of the deque
   ///\ingroup deque
@@ -62,6 +70,8 @@ namespace etl
 
     static const size_t BUFFER_SIZE = MAX_SIZE + 1;
 
+    typedef etl::ring_index<BUFFER_SIZE> index_t;
+
   public:
 
     typedef T        value_type;
@@ -118,6 +128,48 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_out_of_bounds if the index is out of range.
+    ///\return A reference to the item at the index.
+    //*************************************************************************
+    reference at(size_t index)
+    {
+      check_index(index);
+
+      return operator [](index);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_out_of_bounds if the index is out of range.
+    ///\return A const reference to the item at the index.
+    //*************************************************************************
+    const_reference at(size_t index) const
+    {
+      check_index(index);
+
+      return operator [](index);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    ///\return A reference to the item at the index.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return buffer[index_t::add(this->first.get_index(), index)];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    ///\return A const reference to the item at the index.
+    //*************************************************************************
+    const_reference operator [](size_t index) const
+    {
+      return buffer[index_t::add(this->first.get_index(), index)];
+    }
+
     //*************************************************************************
     /// Swap
     //*************************************************************************
@@ -134,6 +186,21 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Raises an etl::deque_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    void check_index(size_t index) const
+    {
+      if (index >= this->current_size)
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw deque_out_of_bounds();
+#else
+        error_handler::error((deque_out_of_bounds()));
+#endif
+      }
+    }
+
     /// The buffer.
     T buffer[BUFFER_SIZE];
   };
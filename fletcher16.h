@@ -0,0 +1,195 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_FLETCHER16__
+#define __ETL_FLETCHER16__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "static_assert.h"
+#include "type_traits.h"
+#include "endian.h"
+#include "hash_input.h"
+#include "checksum_engine.h"
+
+///\defgroup fletcher16 Fletcher-16 checksum
+/// Two running sums of the bytes, modulo 255.
+/// The result is (sum2 << 8) | sum1.
+///\ingroup checksum
+
+namespace etl
+{
+  //***************************************************************************
+  /// Calculates the Fletcher-16 checksum.
+  ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\ingroup fletcher16
+  //***************************************************************************
+  template <const int ENDIANNESS = endian::little>
+  class fletcher16
+  {
+  public:
+
+    typedef uint16_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher16()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    fletcher16(TIterator begin, const TIterator end)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the checksum to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      sum1 = 0;
+      sum2 = 0;
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the checksum.
+    //*************************************************************************
+    template<typename TValue>
+    void add(TValue value)
+    {
+      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
+
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
+    }
+
+    //*************************************************************************
+    /// \param value The char to add to the checksum.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      sum1 = (sum1 + value) % MODULUS;
+      sum2 = (sum2 + sum1) % MODULUS;
+    }
+
+    //*************************************************************************
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Gets the checksum value.
+    //*************************************************************************
+    value_type value() const
+    {
+      return value_type((sum2 << 8) | sum1);
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the checksum.
+    //*************************************************************************
+    template<typename TValue>
+    fletcher16<ENDIANNESS>& operator +=(TValue value)
+    {
+      add(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    static const uint32_t MODULUS = 255;
+
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      __private_checksum__::byte_sums<MODULUS>::add(sum1, sum2, begin, end);
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    uint32_t sum1;
+    uint32_t sum2;
+  };
+}
+
+#endif
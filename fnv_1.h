@@ -31,9 +31,11 @@ SOFTWARE.
 
 #include <stdint.h>
 
+#include "platform.h"
 #include "static_assert.h"
 #include "type_traits.h"
 #include "endian.h"
+#include "hash_input.h"
 
 ///\defgroup fnv_1 FNV-1 & FNV-1a 32 & 64 bit hash calculations
 ///\ingroup maths
@@ -88,20 +90,10 @@ namespace etl
     {
       STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
 
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
     }
 
     //*************************************************************************
@@ -121,10 +113,7 @@ namespace etl
     template<typename TIterator>
     void add(TIterator begin, const TIterator end)
     {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -156,6 +145,46 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
     value_type hash;
 
     static const uint64_t OFFSET_BASIS = 0xCBF29CE484222325;
@@ -210,20 +239,10 @@ namespace etl
     {
       STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
 
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
     }
 
     //*************************************************************************
@@ -242,10 +261,7 @@ namespace etl
     template<typename TIterator>
     void add(TIterator begin, const TIterator end)
     {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -277,6 +293,46 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
     value_type hash;
 
     static const uint64_t OFFSET_BASIS = 0xCBF29CE484222325;
@@ -331,20 +387,10 @@ namespace etl
     {
       STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
 
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
     }
 
     //*************************************************************************
@@ -363,10 +409,7 @@ namespace etl
     template<typename TIterator>
     void add(TIterator begin, const TIterator end)
     {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -398,6 +441,46 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
     value_type hash;
 
     static const uint32_t OFFSET_BASIS = 0x811C9DC5;
@@ -452,20 +535,10 @@ namespace etl
     {
       STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
 
-      if (ENDIANNESS == endian::little)
-      {
-        for (int i = 0; i < sizeof(TValue); ++i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
-      else
-      {
-        for (int i = sizeof(TValue) - 1; i >= 0; --i)
-        {
-          add(uint8_t((value >> (i * 8)) & 0xFF));
-        }
-      }
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
     }
 
     //*************************************************************************
@@ -484,10 +557,7 @@ namespace etl
     template<typename TIterator>
     void add(TIterator begin, const TIterator end)
     {
-      while (begin != end)
-      {
-        add(*begin++);
-      }
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -519,11 +589,122 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
     value_type hash;
 
     static const uint32_t OFFSET_BASIS = 0x811C9DC5;
     static const uint32_t PRIME        = 0x01000193;
   };
+
+#if defined(ETL_CPP11_SUPPORTED)
+  namespace __private_fnv_1__
+  {
+    //*************************************************************************
+    /// Compile time FNV-1 and FNV-1a steps, one character per recursion.
+    //*************************************************************************
+    constexpr uint32_t fnv_1_32(const char* text, uint32_t hash)
+    {
+      return (*text == 0) ? hash : fnv_1_32(text + 1, uint32_t(hash * 0x01000193) ^ uint8_t(*text));
+    }
+
+    constexpr uint32_t fnv_1a_32(const char* text, uint32_t hash)
+    {
+      return (*text == 0) ? hash : fnv_1a_32(text + 1, uint32_t((hash ^ uint8_t(*text)) * 0x01000193));
+    }
+
+    constexpr uint64_t fnv_1_64(const char* text, uint64_t hash)
+    {
+      return (*text == 0) ? hash : fnv_1_64(text + 1, uint64_t(hash * 0x00000100000001b3) ^ uint8_t(*text));
+    }
+
+    constexpr uint64_t fnv_1a_64(const char* text, uint64_t hash)
+    {
+      return (*text == 0) ? hash : fnv_1a_64(text + 1, uint64_t((hash ^ uint8_t(*text)) * 0x00000100000001b3));
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1_32 hash of a null terminated string.
+  /// Evaluated at compile time for string literals, so may be used for case
+  /// labels. The result is the same as fnv_1_32 over the characters.
+  /// The compiler's constexpr recursion limit (512 by default on GCC and
+  /// Clang) limits the length of strings hashed at compile time.
+  ///\ingroup fnv_1_32
+  //***************************************************************************
+  constexpr uint32_t fnv_1_32_string(const char* text)
+  {
+    return __private_fnv_1__::fnv_1_32(text, 0x811C9DC5);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_32 hash of a null terminated string.
+  /// Evaluated at compile time for string literals.
+  ///\ingroup fnv_1a_32
+  //***************************************************************************
+  constexpr uint32_t fnv_1a_32_string(const char* text)
+  {
+    return __private_fnv_1__::fnv_1a_32(text, 0x811C9DC5);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1_64 hash of a null terminated string.
+  /// Evaluated at compile time for string literals.
+  ///\ingroup fnv_1_64
+  //***************************************************************************
+  constexpr uint64_t fnv_1_64_string(const char* text)
+  {
+    return __private_fnv_1__::fnv_1_64(text, 0xCBF29CE484222325);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_64 hash of a null terminated string.
+  /// Evaluated at compile time for string literals.
+  ///\ingroup fnv_1a_64
+  //***************************************************************************
+  constexpr uint64_t fnv_1a_64_string(const char* text)
+  {
+    return __private_fnv_1__::fnv_1a_64(text, 0xCBF29CE484222325);
+  }
+#endif
 }
 
 #endif
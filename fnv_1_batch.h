@@ -0,0 +1,302 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_FNV_1_BATCH__
+#define __ETL_FNV_1_BATCH__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Use AVX2 lanes when the compiler is targeting them.
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define ETL_FNV_1_AVX2
+#endif
+
+///\defgroup fnv_1_batch Batched FNV-1a 32 & 64 bit hash calculations
+/// Hashes many independent keys at once. Groups of keys are processed in
+/// lockstep, so the multiplies of different keys overlap instead of each key
+/// waiting on its own chain of multiplies. With AVX2 the 32 bit hashes are
+/// held in SIMD registers. AVX2 has no 64 bit multiply, so the 64 bit hashes
+/// always use the portable engine.
+/// Each hash is identical to that of fnv_1a_32 or fnv_1a_64.
+/// A group advances together for as many bytes as its shortest key, so keys
+/// of similar lengths give the best throughput.
+///\ingroup fnv_1
+
+namespace etl
+{
+  namespace __private_fnv_1_batch__
+  {
+    //*************************************************************************
+    /// FNV-1a parameters.
+    //*************************************************************************
+    template <typename T>
+    struct fnv_1a_parameters;
+
+    template <>
+    struct fnv_1a_parameters<uint32_t>
+    {
+      static const uint32_t OFFSET_BASIS = 0x811C9DC5;
+      static const uint32_t PRIME        = 0x01000193;
+    };
+
+    template <>
+    struct fnv_1a_parameters<uint64_t>
+    {
+      static const uint64_t OFFSET_BASIS = 0xCBF29CE484222325;
+      static const uint64_t PRIME        = 0x00000100000001b3;
+    };
+
+    //*************************************************************************
+    /// Keys given as an array of pointers and an array of lengths.
+    //*************************************************************************
+    struct indirect_keys
+    {
+      const uint8_t* const* keys;
+      const size_t*         lengths;
+
+      const uint8_t* key(size_t i) const
+      {
+        return keys[i];
+      }
+
+      size_t length(size_t i) const
+      {
+        return lengths[i];
+      }
+    };
+
+    //*************************************************************************
+    /// Keys of the same length, stored one after the other.
+    //*************************************************************************
+    struct contiguous_keys
+    {
+      const uint8_t* keys;
+      size_t         key_length;
+
+      const uint8_t* key(size_t i) const
+      {
+        return keys + (i * key_length);
+      }
+
+      size_t length(size_t) const
+      {
+        return key_length;
+      }
+    };
+
+    //*************************************************************************
+    /// Adds a range of bytes to one hash.
+    //*************************************************************************
+    template <typename T>
+    T add_bytes(T hash, const uint8_t* begin, const uint8_t* end)
+    {
+      while (begin != end)
+      {
+        hash ^= *begin++;
+        hash *= fnv_1a_parameters<T>::PRIME;
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Adds the first 'length' bytes of each key of a group to its hash.
+    /// The portable engine interleaves four lanes in ordinary registers.
+    //*************************************************************************
+    template <typename T>
+    struct engine
+    {
+      static const size_t LANES = 4;
+
+      static void add(T* hashes, const uint8_t* const* keys, size_t length)
+      {
+        const T PRIME = fnv_1a_parameters<T>::PRIME;
+
+        T h0 = hashes[0];
+        T h1 = hashes[1];
+        T h2 = hashes[2];
+        T h3 = hashes[3];
+
+        const uint8_t* k0 = keys[0];
+        const uint8_t* k1 = keys[1];
+        const uint8_t* k2 = keys[2];
+        const uint8_t* k3 = keys[3];
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          h0 = (h0 ^ k0[i]) * PRIME;
+          h1 = (h1 ^ k1[i]) * PRIME;
+          h2 = (h2 ^ k2[i]) * PRIME;
+          h3 = (h3 ^ k3[i]) * PRIME;
+        }
+
+        hashes[0] = h0;
+        hashes[1] = h1;
+        hashes[2] = h2;
+        hashes[3] = h3;
+      }
+    };
+
+#if defined(ETL_FNV_1_AVX2)
+    //*************************************************************************
+    /// 32 bit AVX2 engine.
+    /// Two vectors of eight lanes hide the latency of the multiply.
+    //*************************************************************************
+    template <>
+    struct engine<uint32_t>
+    {
+      static const size_t LANES = 16;
+
+      static void add(uint32_t* hashes, const uint8_t* const* k, size_t length)
+      {
+        const __m256i prime = _mm256_set1_epi32(int(fnv_1a_parameters<uint32_t>::PRIME));
+
+        __m256i h0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes));
+        __m256i h1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes + 8));
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          __m256i b0 = _mm256_setr_epi32(k[0][i], k[1][i], k[2][i],  k[3][i],  k[4][i],  k[5][i],  k[6][i],  k[7][i]);
+          __m256i b1 = _mm256_setr_epi32(k[8][i], k[9][i], k[10][i], k[11][i], k[12][i], k[13][i], k[14][i], k[15][i]);
+
+          h0 = _mm256_mullo_epi32(_mm256_xor_si256(h0, b0), prime);
+          h1 = _mm256_mullo_epi32(_mm256_xor_si256(h1, b1), prime);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes),     h0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes + 8), h1);
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Hashes the keys a group at a time, then the left over keys one by one.
+    //*************************************************************************
+    template <typename T, typename TKeys>
+    void hash_keys(const TKeys& keys, size_t count, T* hashes)
+    {
+      typedef engine<T> engine_t;
+
+      const size_t LANES = engine_t::LANES;
+
+      size_t first = 0;
+
+      for (; (count - first) >= LANES; first += LANES)
+      {
+        T              hash[LANES];
+        const uint8_t* key[LANES];
+        size_t         common = keys.length(first);
+
+        for (size_t lane = 0; lane < LANES; ++lane)
+        {
+          hash[lane] = fnv_1a_parameters<T>::OFFSET_BASIS;
+          key[lane]  = keys.key(first + lane);
+
+          if (keys.length(first + lane) < common)
+          {
+            common = keys.length(first + lane);
+          }
+        }
+
+        engine_t::add(hash, key, common);
+
+        for (size_t lane = 0; lane < LANES; ++lane)
+        {
+          hashes[first + lane] = add_bytes(hash[lane], key[lane] + common, key[lane] + keys.length(first + lane));
+        }
+      }
+
+      for (; first < count; ++first)
+      {
+        const uint8_t* key = keys.key(first);
+
+        hashes[first] = add_bytes(fnv_1a_parameters<T>::OFFSET_BASIS, key, key + keys.length(first));
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_32 hash of each of a set of keys.
+  ///\param keys    The address of each key.
+  ///\param lengths The length of each key, in bytes.
+  ///\param count   The number of keys.
+  ///\param hashes  Receives the hash of each key.
+  ///\ingroup fnv_1_batch
+  //***************************************************************************
+  inline void fnv_1a_32_batch(const uint8_t* const* keys, const size_t* lengths, size_t count, uint32_t* hashes)
+  {
+    __private_fnv_1_batch__::indirect_keys k = { keys, lengths };
+    __private_fnv_1_batch__::hash_keys(k, count, hashes);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_32 hash of each of a set of keys of the same length.
+  ///\param keys       The keys, one after the other.
+  ///\param key_length The length of each key, in bytes.
+  ///\param count      The number of keys.
+  ///\param hashes     Receives the hash of each key.
+  ///\ingroup fnv_1_batch
+  //***************************************************************************
+  inline void fnv_1a_32_batch(const uint8_t* keys, size_t key_length, size_t count, uint32_t* hashes)
+  {
+    __private_fnv_1_batch__::contiguous_keys k = { keys, key_length };
+    __private_fnv_1_batch__::hash_keys(k, count, hashes);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_64 hash of each of a set of keys.
+  ///\param keys    The address of each key.
+  ///\param lengths The length of each key, in bytes.
+  ///\param count   The number of keys.
+  ///\param hashes  Receives the hash of each key.
+  ///\ingroup fnv_1_batch
+  //***************************************************************************
+  inline void fnv_1a_64_batch(const uint8_t* const* keys, const size_t* lengths, size_t count, uint64_t* hashes)
+  {
+    __private_fnv_1_batch__::indirect_keys k = { keys, lengths };
+    __private_fnv_1_batch__::hash_keys(k, count, hashes);
+  }
+
+  //***************************************************************************
+  /// Calculates the fnv_1a_64 hash of each of a set of keys of the same length.
+  ///\param keys       The keys, one after the other.
+  ///\param key_length The length of each key, in bytes.
+  ///\param count      The number of keys.
+  ///\param hashes     Receives the hash of each key.
+  ///\ingroup fnv_1_batch
+  //***************************************************************************
+  inline void fnv_1a_64_batch(const uint8_t* keys, size_t key_length, size_t count, uint64_t* hashes)
+  {
+    __private_fnv_1_batch__::contiguous_keys k = { keys, key_length };
+    __private_fnv_1_batch__::hash_keys(k, count, hashes);
+  }
+}
+
+#endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 // The default hash calculation.
 #include "fnv_1.h"
+#include "xxhash64.h"
 
 #include "type_traits.h"
 
@@ -46,9 +47,9 @@ namespace etl
     //*************************************************************************
     /// Hash to use when size_t is 32 bits.
     //*************************************************************************
-    template <typename T>
+    template <typename T, typename TIterator>
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
-    generic_hash(uint8_t* begin, uint8_t* end)
+    generic_hash(TIterator begin, TIterator end)
     {
       return fnv_1a_32<>(begin, end);
     }
@@ -56,26 +57,81 @@ namespace etl
     //*************************************************************************
     /// Hash to use when size_t is 64 bits.
     //*************************************************************************
-    template <typename T>
+    template <typename T, typename TIterator>
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
-    generic_hash(uint8_t* begin, uint8_t* end)
+    generic_hash(TIterator begin, TIterator end)
     {
       return fnv_1a_64<>(begin, end);
     }
   }
 
+  //***************************************************************************
+  /// Hash policy using FNV-1a, 32 or 64 bit to match size_t.
+  /// The default policy.
+  ///\ingroup hash
+  //***************************************************************************
+  struct hash_policy_fnv_1a
+  {
+    template <typename TIterator>
+    static size_t hash(TIterator begin, TIterator end)
+    {
+      return __private_hash__::generic_hash<size_t>(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Hash policy using xxhash64, truncated to size_t.
+  /// Much faster than FNV-1a for keys longer than a few words.
+  ///\ingroup hash
+  //***************************************************************************
+  struct hash_policy_xxhash64
+  {
+    template <typename TIterator>
+    static size_t hash(TIterator begin, TIterator end)
+    {
+      return size_t(xxhash64<>(begin, end).value());
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the hash of a range, such as a string or a block of bytes.
+  ///\param begin Start of the range.
+  ///\param end   End of the range.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename TIterator>
+  size_t hash_range(TIterator begin, TIterator end)
+  {
+    return hash_policy_fnv_1a::hash(begin, end);
+  }
+
+  //***************************************************************************
+  /// Calculates the hash of a range, using the selected policy.
+  /// e.g. etl::hash_range<etl::hash_policy_xxhash64>(begin, end)
+  ///\param begin Start of the range.
+  ///\param end   End of the range.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename TPolicy, typename TIterator>
+  size_t hash_range(TIterator begin, TIterator end)
+  {
+    return TPolicy::hash(begin, end);
+  }
+
   //***************************************************************************
   /// Generic declaration for etl::hash
+  ///\tparam TPolicy The hash used for types that are wider than size_t.
+  ///                 hash_policy_fnv_1a or hash_policy_xxhash64. Default = hash_policy_fnv_1a.
   ///\ingroup hash
   //***************************************************************************
-  template <typename T> struct hash;
+  template <typename T, typename TPolicy = hash_policy_fnv_1a> struct hash;
 
   //***************************************************************************
   /// Specialisation for bool.
   ///\ingroup hash
   //***************************************************************************
-  template <> 
-  struct hash <bool>
+  template <typename TPolicy>
+  struct hash<bool, TPolicy>
   {
     size_t operator ()(bool v) const
     {
@@ -87,8 +143,8 @@ namespace etl
   /// Specialisation for char.
   ///\ingroup hash
   //***************************************************************************
-  template <> 
-  struct hash<char>
+  template <typename TPolicy>
+  struct hash<char, TPolicy>
   {
     size_t operator ()(char v) const
     {
@@ -100,8 +156,8 @@ namespace etl
   /// Specialisation for signed char.
   ///\ingroup hash
   //***************************************************************************
-  template<> struct
-  hash<signed char>
+  template <typename TPolicy>
+  struct hash<signed char, TPolicy>
   {
     size_t operator ()(signed char v) const
     {
@@ -113,8 +169,8 @@ namespace etl
   /// Specialisation for unsigned char.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<unsigned char>
+  template <typename TPolicy>
+  struct hash<unsigned char, TPolicy>
   {
     size_t operator ()(unsigned char v) const
     {
@@ -126,8 +182,8 @@ namespace etl
   /// Specialisation for wchar_t.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<wchar_t>
+  template <typename TPolicy>
+  struct hash<wchar_t, TPolicy>
   {
     size_t operator ()(wchar_t v) const
     {
@@ -139,8 +195,8 @@ namespace etl
   /// Specialisation for short.
   ///\ingroup hash
   //***************************************************************************
-  template<> 
-  struct hash<short>
+  template <typename TPolicy>
+  struct hash<short, TPolicy>
   {
     size_t operator ()(short v) const
     {
@@ -152,8 +208,8 @@ namespace etl
   /// Specialisation for unsigned short.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<unsigned short>
+  template <typename TPolicy>
+  struct hash<unsigned short, TPolicy>
   {
     size_t operator ()(unsigned short v) const
     {
@@ -165,8 +221,8 @@ namespace etl
   /// Specialisation for int.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<int>
+  template <typename TPolicy>
+  struct hash<int, TPolicy>
   {
     size_t operator ()(int v) const
     {
@@ -178,8 +234,8 @@ namespace etl
   /// Specialisation for unsigned int.
   ///\ingroup hash
   //***************************************************************************
-  template<> 
-  struct hash<unsigned int>
+  template <typename TPolicy>
+  struct hash<unsigned int, TPolicy>
   {
     size_t operator ()(unsigned int v) const
     {
@@ -191,8 +247,8 @@ namespace etl
   /// Specialisation for long.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<long>
+  template <typename TPolicy>
+  struct hash<long, TPolicy>
   {
     size_t operator ()(long v) const
     {
@@ -204,7 +260,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -213,8 +269,8 @@ namespace etl
   /// Specialisation for long long.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<long long>
+  template <typename TPolicy>
+  struct hash<long long, TPolicy>
   {
     size_t operator ()(long long v) const
     {
@@ -226,7 +282,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -235,8 +291,8 @@ namespace etl
   /// Specialisation for unsigned long.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<unsigned long>
+  template <typename TPolicy>
+  struct hash<unsigned long, TPolicy>
   {
     size_t operator ()(unsigned long v) const
     {
@@ -248,7 +304,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -257,8 +313,8 @@ namespace etl
   /// Specialisation for unsigned long long.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<unsigned long long>
+  template <typename TPolicy>
+  struct hash<unsigned long long, TPolicy>
   {
     size_t operator ()(unsigned long long v) const
     {
@@ -270,7 +326,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -279,8 +335,8 @@ namespace etl
   /// Specialisation for float.
   ///\ingroup hash
   //***************************************************************************
-  template<>
-  struct hash<float>
+  template <typename TPolicy>
+  struct hash<float, TPolicy>
   {
     size_t operator ()(float v) const
     {
@@ -292,7 +348,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -301,8 +357,8 @@ namespace etl
   /// Specialisation for double.
   ///\ingroup hash
   //***************************************************************************
-  template<> 
-  struct hash<double>
+  template <typename TPolicy>
+  struct hash<double, TPolicy>
   {
     size_t operator ()(double v) const
     {
@@ -314,7 +370,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -323,8 +379,8 @@ namespace etl
   /// Specialisation for long double.
   ///\ingroup hash
   //***************************************************************************
-  template<> 
-  struct hash<long double>
+  template <typename TPolicy>
+  struct hash<long double, TPolicy>
   {
     size_t operator ()(long double v) const
     {
@@ -336,7 +392,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -345,8 +401,8 @@ namespace etl
   /// Specialisation for pointers.
   ///\ingroup hash
   //***************************************************************************
-  template <typename T> 
-  struct hash<T*>
+  template <typename T, typename TPolicy>
+  struct hash<T*, TPolicy>
   {
     size_t operator ()(T* v) const
     {
@@ -358,7 +414,7 @@ namespace etl
       {
         uint8_t* p = reinterpret_cast<uint8_t*>(&v);
 
-        return __private_hash__::generic_hash<size_t>(p, p + sizeof(v));
+        return TPolicy::hash(p, p + sizeof(v));
       }
     }
   };
@@ -0,0 +1,86 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_HASH_INPUT__
+#define __ETL_HASH_INPUT__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "type_traits.h"
+#include "endian.h"
+
+///\ingroup maths
+
+namespace etl
+{
+  namespace __private_hash_input__
+  {
+    //*************************************************************************
+    /// Is the iterator a pointer to a non-volatile integral type?
+    /// If so, the range is contiguous memory and may be read as bytes.
+    /// Volatile values are read one at a time, through their own type.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_integral_pointer : integral_constant<bool, is_pointer<TIterator>::value &&
+                                                         is_integral<typename remove_pointer<TIterator>::type>::value &&
+                                                         !is_volatile<typename remove_pointer<TIterator>::type>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Does the in-memory byte order of integral values match ENDIANNESS?
+    //*************************************************************************
+    template <const int ENDIANNESS>
+    bool is_memory_order()
+    {
+      return int(endianness()()) == ENDIANNESS;
+    }
+
+    //*************************************************************************
+    /// Writes the bytes of an integral value to 'bytes' in the order given by
+    /// ENDIANNESS.
+    //*************************************************************************
+    template <const int ENDIANNESS, typename TValue>
+    void to_bytes(TValue value, uint8_t* bytes)
+    {
+      typedef typename make_unsigned<TValue>::type unsigned_t;
+
+      unsigned_t u = static_cast<unsigned_t>(value);
+
+      for (size_t i = 0; i < sizeof(TValue); ++i)
+      {
+        const size_t index = (ENDIANNESS == endian::little) ? i : (sizeof(TValue) - 1 - i);
+        bytes[index] = uint8_t(u & 0xFF);
+        u = unsigned_t(u >> 8);
+      }
+    }
+  }
+}
+
+#endif
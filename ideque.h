@@ -36,6 +36,8 @@ SOFTWARE.
 #include "type_traits.h"
 #include "deque_base.h"
 #include "parameter_type.h"
+#include "algorithm.h"
+#include "platform.h"
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -65,6 +67,10 @@ namespace etl
 
     typedef typename parameter_type<T>::type parameter_t;
 
+#if defined(ETL_CPP11_SUPPORTED)
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+#endif
+
     //*************************************************************************
     /// Test for an iterator.
     //*************************************************************************
@@ -746,31 +752,53 @@ namespace etl
         }
         else
         {
-          // Are we closer to the front?
-          if (std::distance(first, position) < std::distance(position, last))
-          {
-            // Move the values.
-            std::copy(first, position, first - 1);
+          position = open_gap(position);
 
-            // Write the new value.
-            *(--position) = value;
+          // Write the new value.
+          *position = value;
+        }
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw deque_full();
+#else
+        error_handler::error(deque_full());
+#endif
+      }
 
-            // Adjust the iterator
-            --first;
-          }
-          else
-          {
-            // Adjust the iterator
-            ++last;
+      return position;
+    }
 
-            // Move the values.
-            std::copy_backward(position, last, last + 1);
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves a value in to the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    ///\param value>The value to insert.
+    //*************************************************************************
+    iterator insert(const_iterator insert_position, rvalue_parameter_t value)
+    {
+      iterator position(insert_position.index, *this, p_buffer);
 
-            // Write the new value.
-            *position = value;
-          }
+      if (!full())
+      {
+        if (insert_position == begin())
+        {
+          push_front(std::move(value));
+          position = first;
+        }
+        else if (insert_position == end())
+        {
+          push_back(std::move(value));
+          position = last;
+        }
+        else
+        {
+          position = open_gap(position);
 
-          ++current_size;
+          // Move in the new value.
+          *position = std::move(value);
         }
       }
       else
@@ -785,6 +813,19 @@ namespace etl
       return position;
     }
 
+    //*************************************************************************
+    /// Constructs a value and moves it in to the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    ///\param args The arguments to construct the value with.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator insert_position, Args&& ... args)
+    {
+      return insert(insert_position, value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Inserts 'n' copies of a value into the deque.
     /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full if the deque is full.
@@ -822,7 +863,7 @@ namespace etl
             iterator new_position = position - n;
 
             // Move the values.
-            std::copy(first, position, new_first);
+            etl::move(first, position, new_first);
 
             // Write the new value.
             std::fill_n(new_position, n, value);
@@ -836,7 +877,7 @@ namespace etl
             iterator new_last = last + n;
 
             // Move the values.
-            std::copy_backward(position, last + 1, new_last + 1);
+            etl::move_backward(position, last + 1, new_last + 1);
 
             // Write the new value.
             std::fill_n(position, n, value);
@@ -913,7 +954,7 @@ namespace etl
             iterator new_position = position - n;
 
             // Move the values.
-            std::copy(first, position, new_first);
+            etl::move(first, position, new_first);
 
             // Write the new values.
             std::copy(range_begin, range_end, new_position);
@@ -927,7 +968,7 @@ namespace etl
             iterator new_last = last + n;
 
             // Move the values.
-            std::copy_backward(position, last + 1, new_last + 1);
+            etl::move_backward(position, last + 1, new_last + 1);
 
             // Write the new values.
             std::copy(range_begin, range_end, position);
@@ -976,13 +1017,13 @@ namespace etl
           // Are we closer to the front?
           if (distance(first, position) < difference_type(current_size / 2))
           {
-            std::copy_backward(first, position, position + 1);
+            etl::move_backward(first, position, position + 1);
             ++first;
             ++position;
           }
           else
           {
-            std::copy(position + 1, last + 1, position);
+            etl::move(position + 1, last + 1, position);
             --last;
           }
         }
@@ -1035,7 +1076,7 @@ namespace etl
           if (distance(first, position) < difference_type(current_size / 2))
           {
             // Move the items.
-            std::copy_backward(first, position, position + length);
+            etl::move_backward(first, position, position + length);
             first += length;
             position += length;
           }
@@ -1043,7 +1084,7 @@ namespace etl
           // Must be closer to the back.
           {
             // Move the items.
-            std::copy(position + length, last + 1, position);
+            etl::move(position + length, last + 1, position);
             last -= length;
           }
         }
@@ -1089,6 +1130,46 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves an item to the back of the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back(rvalue_parameter_t item)
+    {
+      if (!full())
+      {
+        if (!empty())
+        {
+          ++last;
+        }
+
+        *last = std::move(item);
+        ++current_size;
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw deque_full();
+#else
+        error_handler::error(deque_full());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs an item and moves it to the back of the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
+    ///\param args The arguments to construct the item with.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+      push_back(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
@@ -1160,6 +1241,46 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves an item to the front of the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_front(rvalue_parameter_t item)
+    {
+      if (!full())
+      {
+        if (!empty())
+        {
+          --first;
+        }
+
+        *first = std::move(item);
+        ++current_size;
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw deque_full();
+#else
+        error_handler::error(deque_full());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs an item and moves it to the front of the deque.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
+    ///\param args The arguments to construct the item with.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args&& ... args)
+    {
+      push_front(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::deque_full is the deque is already full.
@@ -1324,6 +1445,37 @@ namespace etl
         return index - reference_index;
       }
     }
+
+    //*************************************************************************
+    /// Opens a one item gap at 'position' by shifting the items on the
+    /// shorter side of it. The position must not be the first or the end.
+    ///\return An iterator to the gap.
+    //*************************************************************************
+    iterator open_gap(iterator position)
+    {
+      // Are we closer to the front?
+      if (std::distance(first, position) < std::distance(position, last))
+      {
+        // Move the values.
+        etl::move(first, position, first - 1);
+
+        // Adjust the iterators.
+        --position;
+        --first;
+      }
+      else
+      {
+        // Adjust the iterator
+        ++last;
+
+        // Move the values.
+        etl::move_backward(position, last, last + 1);
+      }
+
+      ++current_size;
+
+      return position;
+    }
   };
 }
 
@@ -43,6 +43,7 @@ SOFTWARE.
 #include "list_base.h"
 #include "type_traits.h"
 #include "parameter_type.h"
+#include "platform.h"
 
 namespace etl
 {
@@ -66,6 +67,10 @@ namespace etl
     
     typedef typename parameter_type<T, is_fundamental<T>::value || is_pointer<T>::value>::type parameter_t;
 
+#if defined(ETL_CPP11_SUPPORTED)
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+#endif
+
 
     //*************************************************************************
     /// The node element in the list.
@@ -617,6 +622,38 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves a value to the front of the list.
+    //*************************************************************************
+    void push_front(rvalue_parameter_t value)
+    {
+      if (!full())
+      {
+        Data_Node& data_node = node_pool[next_free];
+        data_node.value = std::move(value);
+        insert_node(get_head(), data_node);
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw list_full();
+#else
+        error_handler::error(list_full());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value and moves it to the front of the list.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args&& ... args)
+    {
+      push_front(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Removes a value from the front of the list.
     //*************************************************************************
@@ -669,6 +706,38 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves a value to the back of the list.
+    //*************************************************************************
+    void push_back(rvalue_parameter_t value)
+    {
+      if (!full())
+      {
+        Data_Node& data_node = node_pool[next_free];
+        data_node.value = std::move(value);
+        insert_node(terminal_node, data_node);
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw list_full();
+#else
+        error_handler::error(list_full());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value and moves it to the back of the list.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+      push_back(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Removes a value from the back of the list.
     //*************************************************************************
@@ -705,6 +774,42 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves a value in to the list at the specified position.
+    //*************************************************************************
+    iterator insert(iterator position, rvalue_parameter_t value)
+    {
+      if (!full())
+      {
+        Data_Node& data_node = node_pool[next_free];
+        data_node.value = std::move(value);
+
+        insert_node(*position.p_node, data_node);
+
+        return iterator(data_node);
+      }
+      else
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw list_full();
+#else
+        error_handler::error(list_full());
+        return end();
+#endif
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value and moves it in to the list at the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args&& ... args)
+    {
+      return insert(position, value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Inserts 'n' copies of a value to the list at the specified position.
     //*************************************************************************
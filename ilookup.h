@@ -40,6 +40,7 @@ SOFTWARE.
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "ivector.h"
+#include "platform.h"
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -357,6 +358,50 @@ namespace etl
       return i_element;
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*********************************************************************
+    /// Moves a value in to the lookup.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits lookup_full if the lookup is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(value_type&& value)
+    {
+      iterator i_element = std::lower_bound(begin(), end(), value, compare_element());
+
+      if ((i_element != end()) && (value.first == i_element->first))
+      {
+        // Existing element.
+        i_element->second = std::move(value.second);
+      }
+      else if (buffer.full())
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw lookup_full();
+#else
+        error_handler::error(lookup_full());
+#endif
+      }
+      else
+      {
+        // A new one.
+        buffer.insert(i_element, std::move(value));
+      }
+
+      return i_element;
+    }
+
+    //*********************************************************************
+    /// Constructs a value and moves it in to the lookup.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits lookup_full if the lookup is already full.
+    ///\param args The arguments to construct the value with.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args&& ... args)
+    {
+      return insert(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the lookup.
     /// If ETL_THROW_EXCEPTIONS is defined, emits lookup_full if the lookup does not have enough free space.
@@ -396,6 +441,14 @@ namespace etl
       return buffer.erase(first, last);
     }
 
+    //*************************************************************************
+    /// Clears the lookup.
+    //*************************************************************************
+    void clear()
+    {
+      buffer.clear();
+    }
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
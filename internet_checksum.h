@@ -0,0 +1,225 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_INTERNET_CHECKSUM__
+#define __ETL_INTERNET_CHECKSUM__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "static_assert.h"
+#include "type_traits.h"
+#include "endian.h"
+#include "hash_input.h"
+#include "checksum_engine.h"
+
+///\defgroup internet_checksum Internet checksum calculation (RFC 1071)
+/// The 16 bit ones' complement of the ones' complement sum of the data,
+/// taken as big endian 16 bit words. An odd final byte is padded with zero.
+///\ingroup checksum
+
+namespace etl
+{
+  //***************************************************************************
+  /// Calculates the Internet checksum (RFC 1071).
+  ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::big (network order).
+  ///\ingroup internet_checksum
+  //***************************************************************************
+  template <const int ENDIANNESS = endian::big>
+  class internet_checksum
+  {
+  public:
+
+    typedef uint16_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    internet_checksum()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    internet_checksum(TIterator begin, const TIterator end)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the checksum to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      sum = 0;
+      odd = false;
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the checksum.
+    //*************************************************************************
+    template<typename TValue>
+    void add(TValue value)
+    {
+      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
+
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
+    }
+
+    //*************************************************************************
+    /// \param value The char to add to the checksum.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      // Even offsets are the high byte of a word.
+      sum += odd ? uint32_t(value) : (uint32_t(value) << 8);
+      odd = !odd;
+    }
+
+    //*************************************************************************
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Gets the checksum value.
+    //*************************************************************************
+    value_type value() const
+    {
+      uint64_t folded = sum;
+
+      while ((folded >> 16) != 0)
+      {
+        folded = (folded & 0xFFFF) + (folded >> 16);
+      }
+
+      return value_type(~folded);
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the checksum.
+    //*************************************************************************
+    template<typename TValue>
+    internet_checksum<ENDIANNESS>& operator +=(TValue value)
+    {
+      add(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      if (odd && (begin != end))
+      {
+        add(*begin++);
+      }
+
+      // Whole words, in blocks small enough that the engine's sum cannot overflow.
+      const size_t BLOCK = size_t(1) << 30;
+
+      while ((end - begin) >= 2)
+      {
+        size_t length = size_t(end - begin) & ~size_t(1);
+
+        if (length > BLOCK)
+        {
+          length = BLOCK;
+        }
+
+        sum += __private_checksum__::internet_sum(begin, length);
+        begin += length;
+      }
+
+      if (begin != end)
+      {
+        add(*begin);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    uint64_t sum;
+    bool     odd;
+  };
+}
+
+#endif
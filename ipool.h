@@ -30,8 +30,16 @@ SOFTWARE.
 #define __ETL_IPOOL__
 #define __ETL_IN_IPOOL_H__
 
+#include <iterator>
+#include <new>
+
 #include "pool_base.h"
 #include "nullptr.h"
+#include "platform.h"
+
+#if defined(ETL_CPP11_SUPPORTED)
+#include <utility>
+#endif
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -51,20 +59,19 @@ namespace etl
     /// Allocate an object from the pool.
     /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
     /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
-    /// \note The state of the object returned is undefined.
+    /// \note The object returned is not constructed. Use create() to allocate
+    /// and construct in one step.
     //*************************************************************************
     T* allocate()
     {
-      if (next_free != MAX_SIZE)
+      if (items_allocated != MAX_SIZE)
       {
-        T* result = &p_buffer[next_free];
-        in_use_flags.set(next_free);
-        next_free = in_use_flags.find_first(false);
-        ++items_allocated;
-        return result;
+        return &p_buffer[take_free_index()];
       }
       else
       {
+        record_failure();
+
 #ifdef ETL_THROW_EXCEPTIONS
         throw pool_no_allocation();
 #else
@@ -74,11 +81,148 @@ namespace etl
       }
     }
     
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Allocate and construct an object from the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    ///\param args The arguments to construct the object with.
+    //*************************************************************************
+    template <typename ... Args>
+    T* create(Args&& ... args)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T(std::forward<Args>(args)...);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate and default construct an object from the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    T* create()
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T();
+        guard.dismiss();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate and construct an object from the pool with one argument.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T(value1);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate and construct an object from the pool with two arguments.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T(value1, value2);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate and construct an object from the pool with three arguments.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T(value1, value2, value3);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate and construct an object from the pool with four arguments.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate();
+
+      if (p != nullptr)
+      {
+        // Give the item back if the constructor throws.
+        __private_pool__::release_guard<ipool, T> guard(*this, p);
+        ::new (p) T(value1, value2, value3, value4);
+        guard.dismiss();
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroy an object created with create() and release it to the pool.
+    /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    void destroy(const T* const p_object)
+    {
+      if (is_in_pool(p_object))
+      {
+        p_object->~T();
+      }
+
+      release(p_object);
+    }
+
     //*************************************************************************
     /// Free an object in the pool.
     /// If ETL_THROW_EXCEPTIONS is defined and the object does not belong to this
     /// pool then an etl::pool_object_not_in_pool is thrown.
     /// \param p_object A pointer to the object to be released.
+    /// \note The object is not destroyed. Use destroy() for objects made by create().
     //*************************************************************************
     void release(const T& object)
     {
@@ -99,9 +243,7 @@ namespace etl
         typename std::iterator_traits<T*>::difference_type distance = p_object - p_buffer;
 
         // Mark the object as available.
-        next_free = static_cast<size_t>(distance);
-        in_use_flags.reset(next_free);
-        --items_allocated;
+        return_free_index(static_cast<size_t>(distance));
       }
       else
       {
@@ -142,15 +284,13 @@ namespace etl
     //*************************************************************************
     /// Constructor
     //*************************************************************************
-    ipool(T* p_buffer, ibitset& in_use_flags, size_t size)
-      : pool_base(size),
-        p_buffer(nullptr),
-        in_use_flags(in_use_flags)
+    ipool(T* p_buffer, uint32_t* p_free_map, size_t size)
+      : pool_base(p_free_map, size),
+        p_buffer(p_buffer)
     {
     }
 
     T* p_buffer;
-    ibitset& in_use_flags;
   };
 }
 
@@ -31,10 +31,15 @@ SOFTWARE.
 #define __ETL_IN_IQUEUE_H__
 
 #include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 #include "queue_base.h"
 #include "type_traits.h"
 #include "parameter_type.h"
+#include "platform.h"
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -65,10 +70,37 @@ namespace etl
     typedef const T*              const_pointer;   ///< A const pointer to the type used in the qu
     typedef queue_base::size_type size_type;       ///< The type used for determining the size of the queue.
 
+    //*************************************************************************
+    /// A contiguous run of items in the queue's buffer.
+    //*************************************************************************
+    template <typename TPointer>
+    struct basic_span
+    {
+      TPointer  data; ///< The first item.
+      size_type size; ///< The number of items.
+    };
+
+    typedef basic_span<pointer>       span;       ///< A contiguous run of items.
+    typedef basic_span<const_pointer> const_span; ///< A contiguous run of const items.
+
   private:
 
     typedef typename parameter_type<T>::type parameter_t;
 
+    //*************************************************************************
+    /// Is the other range a contiguous array of T that can be copied in bulk?
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_bulk_range : public etl::integral_constant<bool, etl::is_trivially_copyable<T>::value &&
+                                                               etl::is_pointer<TIterator>::value &&
+                                                               etl::is_same<T, typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type>::value>
+    {
+    };
+
+#if defined(ETL_CPP11_SUPPORTED)
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+#endif
+
   public:
 
     //*************************************************************************
@@ -133,6 +165,46 @@ namespace etl
 #endif
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves an item in to the queue.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full is the queue is already full,
+    /// otherwise does nothing if full.
+    ///\param item The item to push to the queue.
+    //*************************************************************************
+    void push(rvalue_parameter_t item)
+    {
+      if (!full())
+      {
+        buffer[in] = std::move(item);
+        in = (in == (MAX_SIZE - 1)) ? 0 : in + 1;
+        ++current_size;
+      }
+      else
+#ifdef ETL_THROW_EXCEPTIONS
+      {
+        throw queue_full();
+      }
+#else
+      {
+        error_handler::error(queue_full());
+      }
+#endif
+    }
+
+    //*************************************************************************
+    /// Constructs an item and moves it in to the queue.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full is the queue is already full,
+    /// otherwise does nothing if full.
+    ///\param args The arguments to construct the item with.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args&& ... args)
+    {
+      push(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Allows a possibly more efficient 'push' by moving to the next input item
     /// and returning a reference to it.
@@ -164,6 +236,129 @@ namespace etl
       return buffer[next];
     }
 
+    //*************************************************************************
+    /// Adds a range of items to the queue.
+    /// Trivially copyable items from an array are copied with memcpy, at most
+    /// one copy for each side of the wrap around.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full if there
+    /// is not room for all of the items, otherwise does nothing if there is not.
+    ///\param first The iterator to the first item.
+    ///\param last  The iterator to the last item + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    void push(TIterator first, TIterator last)
+    {
+      const size_type count = static_cast<size_type>(std::distance(first, last));
+
+      if (count <= available())
+      {
+        // Up to the end of the buffer, then from the start.
+        const size_type to_end = std::min(count, MAX_SIZE - in);
+
+        TIterator middle = first;
+        std::advance(middle, to_end);
+
+        copy_in(first, middle, buffer + in, is_bulk_range<TIterator>());
+        copy_in(middle, last, buffer, is_bulk_range<TIterator>());
+
+        in += count;
+
+        if (in >= MAX_SIZE)
+        {
+          in -= MAX_SIZE;
+        }
+
+        current_size += count;
+      }
+      else
+#ifdef ETL_THROW_EXCEPTIONS
+      {
+        throw queue_full();
+      }
+#else
+      {
+        error_handler::error(queue_full());
+      }
+#endif
+    }
+
+    using queue_base::pop;
+
+    //*************************************************************************
+    /// Removes up to 'n' of the oldest items from the queue.
+    ///\return The number of items removed.
+    //*************************************************************************
+    size_type pop(size_type n)
+    {
+      n = std::min(n, current_size);
+
+      out += n;
+
+      if (out >= MAX_SIZE)
+      {
+        out -= MAX_SIZE;
+      }
+
+      current_size -= n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Moves up to 'n' of the oldest items to 'destination' and removes them
+    /// from the queue.
+    /// Trivially copyable items to an array are copied with memcpy, at most
+    /// one copy for each side of the wrap around.
+    ///\param destination The iterator to write the items to.
+    ///\param n           The maximum number of items to remove.
+    ///\return The number of items removed.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_into(TOutputIterator destination, size_type n)
+    {
+      const std::pair<span, span> spans = peek_spans();
+
+      const size_type from_first  = std::min(n, spans.first.size);
+      const size_type from_second = std::min(n - from_first, spans.second.size);
+
+      destination = move_out(spans.first.data, spans.first.data + from_first, destination, is_bulk_range<TOutputIterator>());
+      move_out(spans.second.data, spans.second.data + from_second, destination, is_bulk_range<TOutputIterator>());
+
+      return pop(from_first + from_second);
+    }
+
+    //*************************************************************************
+    /// Gets the items in the queue as up to two contiguous runs, oldest first.
+    /// The second run is empty unless the items wrap around the end of the
+    /// buffer. The items stay in the queue; remove them with pop(n).
+    ///\return The first and second runs.
+    //*************************************************************************
+    std::pair<span, span> peek_spans()
+    {
+      const size_type to_end = std::min(current_size, MAX_SIZE - out);
+
+      const span first  = { buffer + out, to_end };
+      const span second = { buffer, current_size - to_end };
+
+      return std::pair<span, span>(first, second);
+    }
+
+    //*************************************************************************
+    /// Gets the items in the queue as up to two contiguous runs, oldest first.
+    /// The second run is empty unless the items wrap around the end of the
+    /// buffer.
+    ///\return The first and second runs.
+    //*************************************************************************
+    std::pair<const_span, const_span> peek_spans() const
+    {
+      const size_type to_end = std::min(current_size, MAX_SIZE - out);
+
+      const const_span first  = { buffer + out, to_end };
+      const const_span second = { buffer, current_size - to_end };
+
+      return std::pair<const_span, const_span>(first, second);
+    }
+
   protected:
 
     //*************************************************************************
@@ -177,6 +372,61 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Copies a contiguous range of trivially copyable items in to the buffer.
+    //*************************************************************************
+    template <typename TIterator>
+    static void copy_in(TIterator first, TIterator last, pointer destination, etl::true_type)
+    {
+      if (first != last)
+      {
+        memcpy(destination, first, (last - first) * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    /// Copies a range of items in to the buffer.
+    //*************************************************************************
+    template <typename TIterator>
+    static void copy_in(TIterator first, TIterator last, pointer destination, etl::false_type)
+    {
+      std::copy(first, last, destination);
+    }
+
+    //*************************************************************************
+    /// Copies a contiguous range of trivially copyable items out of the buffer.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    static TOutputIterator move_out(pointer first, pointer last, TOutputIterator destination, etl::true_type)
+    {
+      if (first != last)
+      {
+        memcpy(destination, first, (last - first) * sizeof(T));
+      }
+
+      return destination + (last - first);
+    }
+
+    //*************************************************************************
+    /// Moves a range of items out of the buffer.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    static TOutputIterator move_out(pointer first, pointer last, TOutputIterator destination, etl::false_type)
+    {
+      while (first != last)
+      {
+#if defined(ETL_CPP11_SUPPORTED)
+        *destination = std::move(*first);
+#else
+        *destination = *first;
+#endif
+        ++destination;
+        ++first;
+      }
+
+      return destination;
+    }
+
     T* buffer; ///< The internal buffer.
   };
 }
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "stack_base.h"
 #include "type_traits.h"
 #include "parameter_type.h"
+#include "platform.h"
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -69,6 +70,10 @@ namespace etl
 
     typedef typename parameter_type<T>::type parameter_t;
 
+#if defined(ETL_CPP11_SUPPORTED)
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+#endif
+
   public:
 
     //*************************************************************************
@@ -105,6 +110,45 @@ namespace etl
 #endif
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*************************************************************************
+    /// Moves an item on to the stack.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::stack_full is the stack is already full,
+    /// otherwise does nothing if full.
+    ///\param item The item to push to the stack.
+    //*************************************************************************
+    void push(rvalue_parameter_t item)
+    {
+      if (!full())
+      {
+        top_index = current_size++;
+        buffer[top_index] = std::move(item);
+      }
+      else
+#ifdef ETL_THROW_EXCEPTIONS
+      {
+        throw stack_full();
+      }
+#else
+      {
+        error_handler::error(stack_full());
+      }
+#endif
+    }
+
+    //*************************************************************************
+    /// Constructs an item and moves it on to the stack.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::stack_full is the stack is already full,
+    /// otherwise does nothing if full.
+    ///\param args The arguments to construct the item with.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args&& ... args)
+    {
+      push(value_type(std::forward<Args>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Allows a possibly more efficient 'push' by moving to the next input item
     /// and returning a reference to it.
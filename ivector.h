@@ -33,11 +33,16 @@ SOFTWARE.
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <new>
 #include <stddef.h>
+#include <string.h>
 
 #include "vector_base.h"
 #include "type_traits.h"
 #include "parameter_type.h"
+#include "algorithm.h"
+#include "platform.h"
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
@@ -48,6 +53,9 @@ namespace etl
   //***************************************************************************
   /// The base class for specifically sized vectors.
   /// Can be used as a reference type for all vectors containing a specific type.
+  /// Elements are constructed in the buffer as they are added and destroyed
+  /// as they are removed. Trivially copyable elements are copied and shifted
+  /// in bulk with memmove.
   ///\ingroup vector
   //***************************************************************************
   template <typename T>
@@ -71,10 +79,26 @@ namespace etl
 
     typedef typename parameter_type<T>::type parameter_t;
 
-  public:
+#if defined(ETL_CPP11_SUPPORTED)
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+#endif
+
+  private:
+
+    /// Selects the memmove paths.
+    typedef etl::integral_constant<bool, etl::is_trivially_copyable<T>::value> is_bulk_copyable;
+
+    //*********************************************************************
+    /// Is the source range a contiguous array of T that can be copied in bulk?
+    //*********************************************************************
+    template <typename TIterator>
+    struct is_bulk_source : public etl::integral_constant<bool, etl::is_trivially_copyable<T>::value &&
+                                                                etl::is_pointer<TIterator>::value &&
+                                                                etl::is_same<T, typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type>::value>
+    {
+    };
 
-    // Use the base class void push_back().
-    using vector_base::push_back;
+  public:
 
     //*********************************************************************
     /// Assignment operator.
@@ -84,10 +108,14 @@ namespace etl
     //*********************************************************************
     ivector& operator = (ivector& other)
     {
-      const size_t length = std::min(MAX_SIZE, other.size());
+      if (&other != this)
+      {
+        const size_t length = std::min(MAX_SIZE, other.size());
 
-      std::copy(other.begin(), other.begin() + length, p_buffer);
-      current_size = length;
+        clear();
+        construct_range(other.begin(), other.begin() + length, p_buffer, is_bulk_source<iterator>());
+        current_size = length;
+      }
 
       return *this;
     }
@@ -218,13 +246,19 @@ namespace etl
         error_handler::error(vector_full());
 #endif
       }
+      else
+      {
+        if (newSize > current_size)
+        {
+          std::uninitialized_fill(end(), &p_buffer[newSize], value);
+        }
+        else
+        {
+          destroy(&p_buffer[newSize], end());
+        }
 
-	    if (newSize > current_size)
-	    {
-		    std::fill(&p_buffer[current_size], &p_buffer[newSize], value);
-	    }
-
-	    current_size = newSize;
+        current_size = newSize;
+      }
     }
 
     //*********************************************************************
@@ -360,7 +394,7 @@ namespace etl
 #ifdef ETL_THROW_EXCEPTIONS
         throw vector_iterator();
 #else
-        error_handler::error((vector_iterator));
+        error_handler::error(vector_iterator());
 #endif
       }
       else if (static_cast<size_t>(count) > MAX_SIZE)
@@ -374,7 +408,7 @@ namespace etl
       else
       {
         // Safe to copy.
-        std::copy(first, last, begin());
+        assign_range(first, last, static_cast<size_t>(count), is_bulk_source<TIterator>());
         current_size = count;
       }
     }
@@ -397,11 +431,52 @@ namespace etl
       }
       else
       {
-        std::fill_n(begin(), n, value);
+        // 'value' may be one of the elements, so none are destroyed until the end.
+        const size_t n_assigned = std::min(n, size());
+
+        std::fill_n(begin(), n_assigned, value);
+        std::uninitialized_fill_n(begin() + n_assigned, n - n_assigned, value);
+
+        if (n < size())
+        {
+          destroy(begin() + n, end());
+        }
+
         current_size = n;
       }
     }
 
+    //*************************************************************************
+    /// Clears the vector.
+    /// Does not touch the elements if T is trivially destructible.
+    //*************************************************************************
+    void clear()
+    {
+      destroy(begin(), end());
+      current_size = 0;
+    }
+
+    //*********************************************************************
+    /// Increases the size of the vector by one, and default constructs the new element.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
+    //*********************************************************************
+    void push_back()
+    {
+      if (current_size == MAX_SIZE)
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw vector_full();
+#else
+        error_handler::error(vector_full());
+#endif
+      }
+      else
+      {
+        ::new (&p_buffer[current_size]) T();
+        ++current_size;
+      }
+    }
+
     //*********************************************************************
     /// Inserts a value at the end of the vector.
     /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
@@ -419,7 +494,56 @@ namespace etl
       }
       else
       {
-        p_buffer[current_size++] = value;
+        ::new (&p_buffer[current_size]) T(value);
+        ++current_size;
+      }
+    }
+
+#if defined(ETL_CPP11_SUPPORTED)
+    //*********************************************************************
+    /// Moves a value to the end of the vector.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(rvalue_parameter_t value)
+    {
+      emplace_back(std::move(value));
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
+    ///\param args The arguments to construct the value with.
+    //*********************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+      if (current_size == MAX_SIZE)
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw vector_full();
+#else
+        error_handler::error(vector_full());
+#endif
+      }
+      else
+      {
+        ::new (&p_buffer[current_size]) T(std::forward<Args>(args)...);
+        ++current_size;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes an element from the end of the vector.
+    /// Does nothing if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      if (current_size > 0)
+      {
+        --current_size;
+        p_buffer[current_size].~T();
       }
     }
 
@@ -448,8 +572,7 @@ namespace etl
         }
         else
         {
-          ++current_size;
-          std::copy_backward(position, end() - 1, end());
+          open_gap(position);
           *position = value;
         }
 
@@ -457,6 +580,62 @@ namespace etl
       }
     }
 
+#if defined(ETL_CPP11_SUPPORTED)
+    //*********************************************************************
+    /// Moves a value in to the vector.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator position, rvalue_parameter_t value)
+    {
+      if (position == end())
+      {
+        push_back(std::move(value));
+        return iterator(&back());
+      }
+      else
+      {
+        if ((current_size + 1) > MAX_SIZE)
+        {
+#ifdef ETL_THROW_EXCEPTIONS
+          throw vector_full();
+#else
+          error_handler::error(vector_full());
+#endif
+        }
+        else
+        {
+          open_gap(position);
+          *position = std::move(value);
+        }
+
+        return position;
+      }
+    }
+
+    //*********************************************************************
+    /// Constructs a value in the vector.
+    /// Constructed in place at the end, otherwise moved in to the gap.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector is already full.
+    ///\param position The position to insert at.
+    ///\param args     The arguments to construct the value with.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args&& ... args)
+    {
+      if (position == end())
+      {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(&back());
+      }
+      else
+      {
+        return insert(position, T(std::forward<Args>(args)...));
+      }
+    }
+#endif
+
     //*********************************************************************
     /// Inserts 'n' values to the vector.
     /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if the vector does not have enough free space.
@@ -476,9 +655,8 @@ namespace etl
       }
       else
       {
+        insert_fill(position, n, value, is_bulk_copyable());
         current_size += n;
-        std::copy_backward(position, end() - n, end());
-        std::fill_n(position, n, value);
       }
     }
 
@@ -504,9 +682,8 @@ namespace etl
       }
       else
       {
+        insert_range(position, first, last, count, is_bulk_source<TIterator>());
         current_size += count;
-        std::copy_backward(position, end() - count, end());
-        std::copy(first, first + count, position);
       }
     }
 
@@ -517,10 +694,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
-      --current_size;
-
-      return i_element;
+      return erase(i_element, i_element + 1);
     }
 
     //*********************************************************************
@@ -533,7 +707,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator first, iterator last)
     {
-      std::copy(last, end(), first);
+      erase_range(first, last, is_bulk_copyable());
       current_size -= std::distance(first, last);
 
       return first;
@@ -552,6 +726,218 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Copies 'n' trivially copyable elements between possibly overlapping ranges.
+    //*********************************************************************
+    static void bulk_move(T* destination, const T* source, size_t n)
+    {
+      if (n != 0)
+      {
+        memmove(destination, source, n * sizeof(T));
+      }
+    }
+
+    //*********************************************************************
+    /// Copy constructs a contiguous range of trivially copyable elements.
+    /// The range may overlap the destination when it is part of this vector.
+    //*********************************************************************
+    template <typename TIterator>
+    static void construct_range(TIterator first, TIterator last, iterator destination, etl::true_type)
+    {
+      bulk_move(destination, first, last - first);
+    }
+
+    //*********************************************************************
+    /// Copy constructs a range of elements.
+    //*********************************************************************
+    template <typename TIterator>
+    static void construct_range(TIterator first, TIterator last, iterator destination, etl::false_type)
+    {
+      std::uninitialized_copy(first, last, destination);
+    }
+
+    //*********************************************************************
+    /// Replaces the elements with a contiguous range of trivially copyable values.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator first, TIterator last, size_t, etl::true_type)
+    {
+      construct_range(first, last, p_buffer, etl::true_type());
+    }
+
+    //*********************************************************************
+    /// Replaces the elements with a range of values.
+    /// The range may be part of this vector, so the existing elements are
+    /// assigned to, the extra ones constructed and any left over destroyed.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_range(TIterator first, TIterator last, size_t count, etl::false_type)
+    {
+      iterator destination = begin();
+
+      while ((first != last) && (destination != end()))
+      {
+        *destination++ = *first++;
+      }
+
+      std::uninitialized_copy(first, last, destination);
+
+      if (count < size())
+      {
+        destroy(begin() + count, end());
+      }
+    }
+
+    //*********************************************************************
+    /// Opens a one element gap at 'position'.
+    //*********************************************************************
+    void open_gap(iterator position)
+    {
+      open_gap(position, is_bulk_copyable());
+    }
+
+    //*********************************************************************
+    /// Opens a one element gap at 'position' by shifting the trivially
+    /// copyable elements up in one block.
+    //*********************************************************************
+    void open_gap(iterator position, etl::true_type)
+    {
+      bulk_move(position + 1, position, end() - position);
+      ++current_size;
+    }
+
+    //*********************************************************************
+    /// Opens a one element gap at 'position' by constructing a new last
+    /// element from the current one and shifting the rest up by one.
+    //*********************************************************************
+    void open_gap(iterator position, etl::false_type)
+    {
+#if defined(ETL_CPP11_SUPPORTED)
+      ::new (end()) T(std::move(back()));
+#else
+      ::new (end()) T(back());
+#endif
+      ++current_size;
+      etl::move_backward(position, end() - 2, end() - 1);
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' copies of a trivially copyable value.
+    /// The tail is shifted up in one block.
+    //*********************************************************************
+    void insert_fill(iterator position, size_t n, parameter_t value, etl::true_type)
+    {
+      bulk_move(position + n, position, end() - position);
+      std::uninitialized_fill_n(position, n, value);
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' copies of a value.
+    /// Elements moved past the old end are constructed, the rest assigned.
+    //*********************************************************************
+    void insert_fill(iterator position, size_t n, parameter_t value, etl::false_type)
+    {
+      iterator     old_end     = end();
+      const size_t elems_after = std::distance(position, old_end);
+
+      if (elems_after > n)
+      {
+        etl::uninitialized_move(old_end - n, old_end, old_end);
+        etl::move_backward(position, old_end - n, old_end);
+        std::fill_n(position, n, value);
+      }
+      else
+      {
+        std::uninitialized_fill_n(old_end, n - elems_after, value);
+        etl::uninitialized_move(position, old_end, position + n);
+        std::fill(position, old_end, value);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a contiguous range of trivially copyable values.
+    /// The tail is shifted up and the range copied in, each in one block.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert_range(iterator position, TIterator first, TIterator last, size_t count, etl::true_type)
+    {
+      bulk_move(position + count, position, end() - position);
+      construct_range(first, last, position, etl::true_type());
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values.
+    /// Elements moved past the old end are constructed, the rest assigned.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert_range(iterator position, TIterator first, TIterator last, size_t count, etl::false_type)
+    {
+      iterator     old_end     = end();
+      const size_t elems_after = std::distance(position, old_end);
+
+      if (elems_after > count)
+      {
+        etl::uninitialized_move(old_end - count, old_end, old_end);
+        etl::move_backward(position, old_end - count, old_end);
+        std::copy(first, last, position);
+      }
+      else
+      {
+        TIterator mid = first;
+        std::advance(mid, elems_after);
+
+        std::uninitialized_copy(mid, last, old_end);
+        etl::uninitialized_move(position, old_end, position + count);
+        std::copy(first, mid, position);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases a range of trivially copyable elements.
+    /// The tail is shifted down in one block. There is nothing to destroy.
+    //*********************************************************************
+    void erase_range(iterator first, iterator last, etl::true_type)
+    {
+      bulk_move(first, last, end() - last);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The tail is moved down and the left over elements destroyed.
+    //*********************************************************************
+    void erase_range(iterator first, iterator last, etl::false_type)
+    {
+      iterator new_end = etl::move(last, end(), first);
+      destroy(new_end, end());
+    }
+
+    //*********************************************************************
+    /// Destroys a range of elements.
+    //*********************************************************************
+    void destroy(iterator first, iterator last)
+    {
+      destroy(first, last, etl::integral_constant<bool, etl::is_trivially_destructible<T>::value>());
+    }
+
+    //*********************************************************************
+    /// Destroys a range of trivially destructible elements. Does nothing.
+    //*********************************************************************
+    void destroy(iterator, iterator, etl::true_type)
+    {
+    }
+
+    //*********************************************************************
+    /// Destroys a range of elements that have a destructor.
+    //*********************************************************************
+    void destroy(iterator first, iterator last, etl::false_type)
+    {
+      while (first != last)
+      {
+        first->~T();
+        ++first;
+      }
+    }
+
     T* p_buffer;
   };
 
@@ -164,14 +164,6 @@ namespace etl
       return vbase.available();
     }
 
-    //*************************************************************************
-    /// Clears the lookup.
-    //*************************************************************************
-    void clear()
-    {
-      vbase.clear();
-    }
-
   protected:
 
     //*************************************************************************
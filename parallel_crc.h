@@ -0,0 +1,180 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_PARALLEL_CRC__
+#define __ETL_PARALLEL_CRC__
+
+#include <stddef.h>
+#include <iterator>
+
+#include "static_assert.h"
+
+///\defgroup parallel_crc Chunked CRC calculation
+/// Splits a range into chunks, calculates the CRC of each chunk independently
+/// and merges the partial results with the CRC's combine() function.
+/// The chunks are handed to an executor supplied by the caller, which may run
+/// them on as many threads as it has available.
+/// An executor is any object callable as executor(tasks, count), where 'tasks'
+/// points to an array of 'count' tasks. It must invoke each task's
+/// operator () exactly once and only return when all of them have completed.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// The task that calculates the CRC of one chunk.
+  ///\ingroup parallel_crc
+  //***************************************************************************
+  template <typename TCrc, typename TIterator>
+  struct crc_chunk
+  {
+    TIterator                 begin;
+    TIterator                 end;
+    typename TCrc::value_type crc;
+
+    void operator ()()
+    {
+      crc = TCrc(begin, end).value();
+    }
+  };
+
+  //***************************************************************************
+  /// An executor that runs the tasks one after the other on the calling thread.
+  ///\ingroup parallel_crc
+  //***************************************************************************
+  struct crc_sequential_executor
+  {
+    template <typename TTask>
+    void operator ()(TTask* tasks, size_t count) const
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        tasks[i]();
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates a CRC over a random access range by splitting it into chunks.
+  ///\tparam TCrc       The CRC type. Must supply a static combine() function.
+  ///\tparam MAX_CHUNKS The maximum number of chunks the range is split into.
+  ///\ingroup parallel_crc
+  //***************************************************************************
+  template <typename TCrc, const size_t MAX_CHUNKS = 8>
+  class parallel_crc
+  {
+  public:
+
+    STATIC_ASSERT(MAX_CHUNKS > 0, "Zero chunks");
+
+    typedef typename TCrc::value_type value_type;
+
+    static const size_t DEFAULT_THRESHOLD = 1024 * 1024;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param threshold_ Ranges smaller than this, in bytes, are calculated as a single chunk on the calling thread.
+    //*************************************************************************
+    explicit parallel_crc(size_t threshold_ = DEFAULT_THRESHOLD)
+      : threshold(threshold_)
+    {
+    }
+
+    //*************************************************************************
+    /// Calculates the CRC of the range, running the chunks on the executor.
+    /// \param begin    Start of the range.
+    /// \param end      End of the range.
+    /// \param executor The executor that runs the chunk tasks.
+    //*************************************************************************
+    template <typename TIterator, typename TExecutor>
+    value_type calculate(TIterator begin, TIterator end, TExecutor& executor) const
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type element_t;
+
+      const size_t count = std::distance(begin, end);
+
+      if ((count == 0) || ((count * sizeof(element_t)) < threshold))
+      {
+        return TCrc(begin, end).value();
+      }
+
+      // Divide the range as evenly as possible.
+      const size_t n_chunks = (count < MAX_CHUNKS) ? count : MAX_CHUNKS;
+      const size_t size     = count / n_chunks;
+      const size_t extra    = count % n_chunks;
+
+      crc_chunk<TCrc, TIterator> chunks[MAX_CHUNKS] = {};
+
+      for (size_t i = 0; i < n_chunks; ++i)
+      {
+        chunks[i].begin = begin;
+        std::advance(begin, size + ((i < extra) ? 1 : 0));
+        chunks[i].end = begin;
+      }
+
+      executor(chunks, n_chunks);
+
+      value_type crc = chunks[0].crc;
+
+      for (size_t i = 1; i < n_chunks; ++i)
+      {
+        const size_t length = std::distance(chunks[i].begin, chunks[i].end) * sizeof(element_t);
+        crc = TCrc::combine(crc, chunks[i].crc, length);
+      }
+
+      return crc;
+    }
+
+    //*************************************************************************
+    /// Calculates the CRC of the range on the calling thread.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    value_type calculate(TIterator begin, TIterator end) const
+    {
+      crc_sequential_executor executor;
+
+      return calculate(begin, end, executor);
+    }
+
+    //*************************************************************************
+    /// Gets the threshold below which the range is not split.
+    //*************************************************************************
+    size_t get_threshold() const
+    {
+      return threshold;
+    }
+
+  private:
+
+    size_t threshold;
+  };
+}
+
+#endif
@@ -30,6 +30,7 @@ SOFTWARE.
 #define __ETL_PARAMETER__
 
 #include "type_traits.h"
+#include "platform.h"
 
 namespace etl
 {
@@ -56,6 +57,35 @@ namespace etl
   {
     typedef const T& type;
   };
+
+#if defined(ETL_CPP11_SUPPORTED)
+  //*************************************************************************
+  /// Determine the parameter type for rvalue overloads.
+  /// Types passed by value gain nothing from a move, so their rvalue overload
+  /// takes a type that can never be passed, and the by value overload is used.
+  //*************************************************************************
+  template <typename T, const bool should_pass_by_value = is_fundamental<T>::value || is_pointer<T>::value>
+  struct rvalue_parameter_type;
+
+  //*************************************************************************
+  /// Pass by value. No rvalue overload.
+  //*************************************************************************
+  template <typename T>
+  struct rvalue_parameter_type<T, true>
+  {
+    struct not_used;
+    typedef not_used&& type;
+  };
+
+  //*************************************************************************
+  /// Pass by rvalue reference.
+  //*************************************************************************
+  template <typename T>
+  struct rvalue_parameter_type<T, false>
+  {
+    typedef T&& type;
+  };
+#endif
 }
 
 #endif
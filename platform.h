@@ -0,0 +1,51 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_PLATFORM__
+#define __ETL_PLATFORM__
+
+///\defgroup platform platform
+/// Detects the language features available from the compiler.
+/// ETL_CPP11_SUPPORTED is defined if the compiler supports C++11
+/// (constexpr, rvalue references, variadic templates and <atomic>).
+/// Define ETL_NO_CPP11 to restrict the library to C++03 features.
+/// ETL_CACHE_LINE_SIZE is the distance used to keep data written by
+/// different threads apart. It defaults to 64 bytes.
+///\ingroup utilities
+
+#if !defined(ETL_NO_CPP11)
+  #if (defined(__cplusplus) && (__cplusplus >= 201103L)) || (defined(_MSC_VER) && (_MSC_VER >= 1900))
+    #define ETL_CPP11_SUPPORTED
+  #endif
+#endif
+
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
+#endif
@@ -29,8 +29,10 @@ SOFTWARE.
 #ifndef __ETL_POOL__
 #define __ETL_POOL__
 
-#include "bitset.h"
+#include <stdint.h>
+
 #include "ipool.h"
+#include "alignment.h"
 
 #include <iterator>
 
@@ -44,7 +46,9 @@ namespace etl
 {
   //*************************************************************************
   /// A templated pool implementation that uses a fixed size pool.
-  /// SIZE_ elements will be always be constructed.
+  /// Items are not constructed until they are created, so T need not be
+  /// default constructible.
+  /// \note Objects still in use when the pool is destroyed are not destroyed.
   ///\ingroup pool
   //*************************************************************************
   template <typename T, const size_t SIZE_>
@@ -58,14 +62,16 @@ namespace etl
     /// Constructor
     //*************************************************************************
     pool()
-      : ipool<T>(buffer, in_use, SIZE)
+      : ipool<T>(reinterpret_cast<T*>(&buffer), free_map, SIZE)
     {
     }
 
   private:
 
-    T            buffer[SIZE]; ///< The pool of objects.
-    bitset<SIZE> in_use;       ///< The set of flags that indicate which items are free in the pool.
+    /// The storage for the pool of objects.
+    typename etl::aligned_storage<sizeof(T) * SIZE, etl::alignment_of<T>::value>::type buffer;
+
+    uint32_t free_map[__private_pool__::free_map_words<SIZE>::value]; ///< The bitmap of free items in the pool.
   };
 }
 #endif
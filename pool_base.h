@@ -34,15 +34,76 @@ SOFTWARE.
 #define __ETL_POOL_BASE__
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "exception.h"
+#include "nullptr.h"
+
+#if defined(COMPILER_MICROSOFT)
+#include <intrin.h>
+#endif
 
 #ifndef ETL_THROW_EXCEPTIONS
 #include "error_handler.h"
 #endif
 
+//*****************************************************************************
+// Pool statistics. Nothing is recorded unless they are enabled.
+// Define ETL_POOL_STATISTICS to record the call counts, failures and high
+// water mark of each pool.
+// Define ETL_POOL_LATENCY_HISTOGRAM to also record the latency of each
+// allocation and release in power of two buckets of timestamp ticks.
+// ETL_POOL_TIMESTAMP() supplies the timestamp. It defaults to the x86 time
+// stamp counter with GCC or Microsoft compilers and must be defined for
+// other targets, for example as a cycle counter read.
+// ETL_POOL_LATENCY_BUCKETS sets the number of buckets. The default is 16.
+//*****************************************************************************
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+  #if !defined(ETL_POOL_STATISTICS)
+    #define ETL_POOL_STATISTICS
+  #endif
+
+  #if !defined(ETL_POOL_TIMESTAMP)
+    #if defined(COMPILER_GCC) && (defined(__i386__) || defined(__x86_64__))
+      #include <x86intrin.h>
+      #define ETL_POOL_TIMESTAMP() __rdtsc()
+    #elif defined(COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+      #define ETL_POOL_TIMESTAMP() __rdtsc()
+    #else
+      #error ETL_POOL_LATENCY_HISTOGRAM needs ETL_POOL_TIMESTAMP() for this target
+    #endif
+  #endif
+
+  #if !defined(ETL_POOL_LATENCY_BUCKETS)
+    #define ETL_POOL_LATENCY_BUCKETS 16
+  #endif
+#endif
+
 namespace etl
 {
+#if defined(ETL_POOL_STATISTICS)
+  //***************************************************************************
+  /// A snapshot of the statistics of a pool.
+  ///\ingroup pool
+  //***************************************************************************
+  struct pool_statistics
+  {
+    size_t max_size;    ///< The number of items in the pool.
+    size_t in_use;      ///< The number of items allocated now.
+    size_t high_water;  ///< The largest number of items allocated at once.
+    size_t allocations; ///< The number of successful allocations.
+    size_t releases;    ///< The number of releases.
+    size_t failures;    ///< The number of allocations refused because the pool was full.
+
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+    /// Bucket i counts the calls that took from 2^i to 2^(i+1) - 1 ticks.
+    /// The first bucket also counts zero ticks and the last counts all longer calls.
+    size_t allocate_latency[ETL_POOL_LATENCY_BUCKETS];
+    size_t release_latency[ETL_POOL_LATENCY_BUCKETS];
+#endif
+  };
+#endif
+
   //***************************************************************************
   /// The base class for pool exceptions.
   ///\ingroup pool
@@ -82,8 +143,122 @@ namespace etl
     {}
   };
   
+  namespace __private_pool__
+  {
+    //*************************************************************************
+    /// The number of 32 bit words needed for the free map of a pool of N items.
+    /// Each level has one bit per word of the level below, up to a single word.
+    //*************************************************************************
+    template <const size_t N, const bool IS_TOP = (N <= 32)>
+    struct free_map_words
+    {
+      static const size_t value = ((N + 31) / 32) + free_map_words<(N + 31) / 32>::value;
+    };
+
+    template <const size_t N>
+    struct free_map_words<N, true>
+    {
+      static const size_t value = 1;
+    };
+
+    //*************************************************************************
+    /// The index of the lowest set bit. The value must not be zero.
+    //*************************************************************************
+    inline size_t count_trailing_zeros(uint32_t value)
+    {
+#if defined(COMPILER_GCC)
+      return __builtin_ctz(value);
+#elif defined(COMPILER_MICROSOFT)
+      unsigned long index;
+      _BitScanForward(&index, value);
+      return index;
+#else
+      // De Bruijn sequence lookup.
+      static const uint8_t position[32] =
+      {
+        0,  1,  28, 2,  29, 14, 24, 3,  30, 22, 20, 15, 25, 17, 4,  8,
+        31, 27, 13, 23, 21, 19, 16, 7,  26, 12, 18, 6,  11, 5,  10, 9
+      };
+
+      return position[((value & (0U - value)) * 0x077CB531U) >> 27];
+#endif
+    }
+
+    //*************************************************************************
+    /// Releases an allocated item back to its pool when it goes out of scope,
+    /// unless dismissed, so that the item is not lost if its constructor throws.
+    //*************************************************************************
+    template <typename TPool, typename T>
+    class release_guard
+    {
+    public:
+
+      release_guard(TPool& pool, T* p_item)
+        : pool(pool),
+          p_item(p_item)
+      {
+      }
+
+      ~release_guard()
+      {
+        if (p_item != nullptr)
+        {
+          pool.release(p_item);
+        }
+      }
+
+      void dismiss()
+      {
+        p_item = nullptr;
+      }
+
+    private:
+
+      // Disabled.
+      release_guard(const release_guard&);
+      release_guard& operator =(const release_guard&);
+
+      TPool& pool;
+      T*     p_item;
+    };
+
+    //*************************************************************************
+    /// The index of the highest set bit. The value must not be zero.
+    //*************************************************************************
+    inline size_t highest_set_bit(uint32_t value)
+    {
+#if defined(COMPILER_GCC)
+      return 31 - __builtin_clz(value);
+#elif defined(COMPILER_MICROSOFT)
+      unsigned long index;
+      _BitScanReverse(&index, value);
+      return index;
+#else
+      // Set every bit below the highest, then a De Bruijn sequence lookup.
+      static const uint8_t position[32] =
+      {
+        0,  9,  1,  10, 13, 21, 2,  29, 11, 14, 16, 18, 22, 25, 3,  30,
+        8,  12, 20, 28, 15, 17, 24, 7,  19, 27, 23, 6,  26, 5,  4,  31
+      };
+
+      value |= value >> 1;
+      value |= value >> 2;
+      value |= value >> 4;
+      value |= value >> 8;
+      value |= value >> 16;
+
+      return position[(value * 0x07C4ACDDU) >> 27];
+#endif
+    }
+  }
+
   //*************************************************************************
   /// The base class for all templated pool types.
+  /// Free items are tracked in a hierarchical bitmap. The bottom level has
+  /// a set bit for each free item. Each level above has a set bit for each
+  /// non-zero word in the level below, up to a single top word. Allocation
+  /// and release touch one word per level, so cost does not depend on how
+  /// full the pool is.
   ///\ingroup pool
   //*************************************************************************
   class pool_base
@@ -107,21 +282,239 @@ namespace etl
       return items_allocated == MAX_SIZE;
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns a snapshot of the statistics.
+    //*************************************************************************
+    pool_statistics get_statistics() const
+    {
+      pool_statistics snapshot = statistics;
+
+      snapshot.max_size = MAX_SIZE;
+      snapshot.in_use   = items_allocated;
+
+      return snapshot;
+    }
+
+    //*************************************************************************
+    /// Clears the statistics. The high water mark restarts from the number
+    /// of items allocated now.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      statistics = pool_statistics();
+      statistics.high_water = items_allocated;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
     /// Constructor
+    ///\param p_free_map Storage for the free map. free_map_words<max_size>::value words.
+    ///\param max_size   The number of items in the pool.
     //*************************************************************************
-    pool_base(size_t max_size)
-      : next_free(0),
+    pool_base(uint32_t* p_free_map, size_t max_size)
+      : p_free_map(p_free_map),
         items_allocated(0),
-        MAX_SIZE(max_size)       
+        MAX_SIZE(max_size)
     {
+      initialise_free_map();
+
+#if defined(ETL_POOL_STATISTICS)
+      statistics = pool_statistics();
+#endif
+    }
+
+    //*************************************************************************
+    /// Records an allocation refused because the pool was full.
+    //*************************************************************************
+    void record_failure()
+    {
+#if defined(ETL_POOL_STATISTICS)
+      ++statistics.failures;
+#endif
     }
 
-    size_t       next_free;       ///< The position of the next free item in the pool.
+    //*************************************************************************
+    /// Takes the lowest free index from the free map.
+    /// The pool must not be empty.
+    //*************************************************************************
+    size_t take_free_index()
+    {
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+      const uint64_t start = ETL_POOL_TIMESTAMP();
+#endif
+
+      size_t offsets[MAX_LEVELS];
+      const size_t levels = get_level_offsets(offsets);
+
+      // Follow the lowest set bits down from the top word.
+      size_t index = 0;
+
+      for (size_t level = levels; level-- > 0;)
+      {
+        index = (index << 5) + __private_pool__::count_trailing_zeros(p_free_map[offsets[level] + index]);
+      }
+
+      // Mark it as used, clearing the parent bits of any word that becomes empty.
+      size_t position = index;
+
+      for (size_t level = 0; level < levels; ++level)
+      {
+        uint32_t& word = p_free_map[offsets[level] + (position >> 5)];
+        word &= ~(uint32_t(1) << (position & 31));
+
+        if (word != 0)
+        {
+          break;
+        }
+
+        position >>= 5;
+      }
+
+      ++items_allocated;
+
+#if defined(ETL_POOL_STATISTICS)
+      ++statistics.allocations;
+
+      if (items_allocated > statistics.high_water)
+      {
+        statistics.high_water = items_allocated;
+      }
+#endif
+
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+      record_latency(statistics.allocate_latency, ETL_POOL_TIMESTAMP() - start);
+#endif
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Returns an index to the free map.
+    //*************************************************************************
+    void return_free_index(size_t index)
+    {
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+      const uint64_t start = ETL_POOL_TIMESTAMP();
+#endif
+
+      size_t offsets[MAX_LEVELS];
+      const size_t levels = get_level_offsets(offsets);
+
+      // Mark it as free, setting the parent bits of any word that was empty.
+      for (size_t level = 0; level < levels; ++level)
+      {
+        uint32_t& word = p_free_map[offsets[level] + (index >> 5)];
+        const bool was_empty = (word == 0);
+
+        word |= (uint32_t(1) << (index & 31));
+
+        if (!was_empty)
+        {
+          break;
+        }
+
+        index >>= 5;
+      }
+
+      --items_allocated;
+
+#if defined(ETL_POOL_STATISTICS)
+      ++statistics.releases;
+#endif
+
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+      record_latency(statistics.release_latency, ETL_POOL_TIMESTAMP() - start);
+#endif
+    }
+
+    uint32_t*    p_free_map;      ///< The free map.
     size_t       items_allocated; ///< The number of items allocated.
     const size_t MAX_SIZE;        ///< The maximum number of objects that can be allocated.
+
+  private:
+
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+    //*************************************************************************
+    /// Adds a latency to a histogram.
+    //*************************************************************************
+    static void record_latency(size_t* buckets, uint64_t ticks)
+    {
+      size_t bucket = ETL_POOL_LATENCY_BUCKETS - 1;
+
+      if (ticks == 0)
+      {
+        bucket = 0;
+      }
+      else if (ticks <= 0xFFFFFFFFUL)
+      {
+        const size_t bit = __private_pool__::highest_set_bit(static_cast<uint32_t>(ticks));
+
+        if (bit < bucket)
+        {
+          bucket = bit;
+        }
+      }
+
+      ++buckets[bucket];
+    }
+#endif
+
+#if defined(ETL_POOL_STATISTICS)
+    pool_statistics statistics; ///< The statistics.
+#endif
+
+    /// Enough levels for any size_t number of items.
+    static const size_t MAX_LEVELS = ((sizeof(size_t) * 8) + 4) / 5;
+
+    //*************************************************************************
+    /// Gets the word offset of each level of the free map.
+    ///\return The number of levels.
+    //*************************************************************************
+    size_t get_level_offsets(size_t* offsets) const
+    {
+      size_t bits   = MAX_SIZE;
+      size_t levels = 1;
+
+      offsets[0] = 0;
+
+      while (bits > 32)
+      {
+        const size_t words = (bits + 31) >> 5;
+
+        offsets[levels] = offsets[levels - 1] + words;
+        bits = words;
+        ++levels;
+      }
+
+      return levels;
+    }
+
+    //*************************************************************************
+    /// Marks every item as free.
+    //*************************************************************************
+    void initialise_free_map()
+    {
+      size_t offsets[MAX_LEVELS];
+      const size_t levels = get_level_offsets(offsets);
+
+      size_t bits = MAX_SIZE;
+
+      for (size_t level = 0; level < levels; ++level)
+      {
+        const size_t words = (bits + 31) >> 5;
+
+        for (size_t i = 0; i < words; ++i)
+        {
+          const size_t remaining = bits - (i << 5);
+          p_free_map[offsets[level] + i] = (remaining >= 32) ? ~uint32_t(0) : ((uint32_t(1) << remaining) - 1);
+        }
+
+        bits = words;
+      }
+    }
   };
 }
 #endif
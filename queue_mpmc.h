@@ -0,0 +1,500 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_QUEUE_MPMC__
+#define __ETL_QUEUE_MPMC__
+
+#include "platform.h"
+
+// Needs std::atomic.
+#if defined(ETL_CPP11_SUPPORTED)
+
+#include <stddef.h>
+
+#include <atomic>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "iqueue.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
+
+//*****************************************************************************
+///\defgroup queue_mpmc queue_mpmc
+/// A fixed capacity queue for any number of producer and consumer threads,
+/// without a lock. Requires C++11.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_queue_mpmc__
+  {
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    template <typename T>
+    struct cell
+    {
+      std::atomic<size_t> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+
+      T& value()
+      {
+        return *reinterpret_cast<T*>(&storage);
+      }
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all multi-producer, multi-consumer queues
+  /// that contain a particular type.
+  ///\details Each slot has a sequence number that says whose turn it is.
+  /// A slot at position 'p' may be written when its sequence is 'p' and read
+  /// when it is 'p + 1'. After reading, the sequence is set to 'p + capacity',
+  /// ready for the producer on the next lap. Producers and consumers claim
+  /// positions with a compare and swap on their own counter, so they only
+  /// contend with their own kind, and an item is never seen before it is
+  /// complete. The capacity must be a power of two.
+  /// Items are only constructed while they are in the queue.
+  /// \tparam T The type of item that the queue holds.
+  //***************************************************************************
+  template <typename T>
+  class iqueue_mpmc
+  {
+  public:
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+    typedef size_t   size_type;       ///< The type used for determining the size of the queue.
+
+  private:
+
+    typedef typename parameter_type<T>::type        parameter_t;
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+    typedef __private_queue_mpmc__::cell<T>         cell_t;
+
+  public:
+
+    //*************************************************************************
+    /// Adds an item to the queue.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full if the queue is full,
+    /// otherwise does nothing if full.
+    //*************************************************************************
+    void push(parameter_t item)
+    {
+      emplace(item);
+    }
+
+    //*************************************************************************
+    /// Moves an item in to the queue.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full if the queue is full,
+    /// otherwise does nothing if full.
+    //*************************************************************************
+    void push(rvalue_parameter_t item)
+    {
+      emplace(std::move(item));
+    }
+
+    //*************************************************************************
+    /// Constructs an item in the queue.
+    /// If ETL_THROW_EXCEPTIONS is defined, throws an etl::queue_full if the queue is full,
+    /// otherwise does nothing if full.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args&& ... args)
+    {
+      if (!try_emplace(std::forward<Args>(args)...))
+#ifdef ETL_THROW_EXCEPTIONS
+      {
+        throw queue_full();
+      }
+#else
+      {
+        error_handler::error(queue_full());
+      }
+#endif
+    }
+
+    //*************************************************************************
+    /// Adds an item to the queue if there is room.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool try_push(parameter_t item)
+    {
+      return try_emplace(item);
+    }
+
+    //*************************************************************************
+    /// Moves an item in to the queue if there is room.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool try_push(rvalue_parameter_t item)
+    {
+      return try_emplace(std::move(item));
+    }
+
+    //*************************************************************************
+    /// Constructs an item in the queue if there is room.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool try_emplace(Args&& ... args)
+    {
+      size_t position;
+
+      if (claim_for_push(position, 1) == 0)
+      {
+        return false;
+      }
+
+      cell_t& cell = p_cells[position & MASK];
+
+      ::new (&cell.storage) T(std::forward<Args>(args)...);
+      cell.sequence.store(position + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Copies as many items from the range as there is room for, in one
+    /// claim on the queue. The items pushed are consecutive in the queue.
+    ///\return The number of items pushed, from the start of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t try_push(TIterator first, TIterator last)
+    {
+      size_t position;
+
+      const size_t count = claim_for_push(position, static_cast<size_t>(std::distance(first, last)));
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        cell_t& cell = p_cells[(position + i) & MASK];
+
+        ::new (&cell.storage) T(*first);
+        cell.sequence.store(position + i + 1, std::memory_order_release);
+
+        ++first;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Moves the item at the front of the queue to 'item' and removes it.
+    ///\return <b>true</b> if an item was removed, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool try_pop(reference item)
+    {
+      return try_pop(&item, 1) == 1;
+    }
+
+    //*************************************************************************
+    /// Moves up to 'n' items from the front of the queue to 'out', in one
+    /// claim on the queue. The items popped are consecutive in the queue.
+    ///\return The number of items popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_t try_pop(TOutputIterator out, size_t n)
+    {
+      size_t position;
+
+      const size_t count = claim_for_pop(position, n);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        cell_t& cell = p_cells[(position + i) & MASK];
+
+        *out = std::move(cell.value());
+        ++out;
+
+        cell.value().~T();
+        cell.sequence.store(position + i + MASK + 1, std::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the queue.
+    /// The value may be out of date as soon as it is returned.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_t read  = read_position.load(std::memory_order_acquire);
+      const size_t write = write_position.load(std::memory_order_acquire);
+
+      // Positions are claimed before the items are written or read.
+      const size_t count = write - read;
+
+      return (count > MAX_SIZE) ? MAX_SIZE : count;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    /// The derived class calls initialise() once its slots are constructed.
+    ///\param p_cells  The slots. 'max_size' of them.
+    ///\param max_size The capacity. A power of two.
+    //*************************************************************************
+    iqueue_mpmc(cell_t* p_cells, size_type max_size)
+      : p_cells(p_cells),
+        MAX_SIZE(max_size),
+        MASK(max_size - 1),
+        write_position(0),
+        read_position(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the sequence of each slot, ready for the first lap.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Destroys the items still in the queue.
+    /// Must not be called while other threads use the queue.
+    //*************************************************************************
+    void destroy_all()
+    {
+      const size_t write = write_position.load(std::memory_order_acquire);
+
+      for (size_t position = read_position.load(std::memory_order_acquire); position != write; ++position)
+      {
+        p_cells[position & MASK].value().~T();
+      }
+
+      read_position.store(write, std::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims up to 'n' consecutive free slots for writing.
+    ///\return The number claimed. 'position' is set to the first.
+    //*************************************************************************
+    size_t claim_for_push(size_t& position, size_t n)
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      position = write_position.load(std::memory_order_relaxed);
+
+      for (;;)
+      {
+        const size_t sequence = p_cells[position & MASK].sequence.load(std::memory_order_acquire);
+        const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+
+        if (difference == 0)
+        {
+          // Count the following slots that are also free on this lap.
+          size_t count = 1;
+
+          while ((count < n) && (p_cells[(position + count) & MASK].sequence.load(std::memory_order_acquire) == (position + count)))
+          {
+            ++count;
+          }
+
+          if (write_position.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+          {
+            return count;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been read since the last lap, so the queue is full.
+          return 0;
+        }
+        else
+        {
+          // Another producer has taken this position.
+          position = write_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims up to 'n' consecutive written slots for reading.
+    ///\return The number claimed. 'position' is set to the first.
+    //*************************************************************************
+    size_t claim_for_pop(size_t& position, size_t n)
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      position = read_position.load(std::memory_order_relaxed);
+
+      for (;;)
+      {
+        const size_t sequence = p_cells[position & MASK].sequence.load(std::memory_order_acquire);
+        const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - (position + 1));
+
+        if (difference == 0)
+        {
+          // Count the following slots that have also been written.
+          size_t count = 1;
+
+          while ((count < n) && (p_cells[(position + count) & MASK].sequence.load(std::memory_order_acquire) == (position + count + 1)))
+          {
+            ++count;
+          }
+
+          if (read_position.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+          {
+            return count;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been written on this lap, so the queue is empty.
+          return 0;
+        }
+        else
+        {
+          // Another consumer has taken this position.
+          position = read_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Disabled.
+    iqueue_mpmc(const iqueue_mpmc&);
+    iqueue_mpmc& operator =(const iqueue_mpmc&);
+
+    cell_t* const       p_cells;
+    const size_type     MAX_SIZE;
+    const size_t        MASK;
+    char                padding1[ETL_CACHE_LINE_SIZE];
+    std::atomic<size_t> write_position; ///< The next position to write, shared by the producers.
+    char                padding2[ETL_CACHE_LINE_SIZE];
+    std::atomic<size_t> read_position;  ///< The next position to read, shared by the consumers.
+    char                padding3[ETL_CACHE_LINE_SIZE];
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity, lock-free, multi-producer, multi-consumer queue.
+  /// \tparam T    The type this queue should support.
+  /// \tparam SIZE The maximum capacity of the queue. A power of two.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class queue_mpmc : public iqueue_mpmc<T>
+  {
+  public:
+
+    STATIC_ASSERT((SIZE > 0) && ((SIZE & (SIZE - 1)) == 0), "SIZE must be a power of two");
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc()
+      : iqueue_mpmc<T>(cells, SIZE)
+    {
+      // The slots are members of this class, so are not constructed until
+      // after the base class.
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor. Destroys any items still in the queue.
+    //*************************************************************************
+    ~queue_mpmc()
+    {
+      this->destroy_all();
+    }
+
+  private:
+
+    __private_queue_mpmc__::cell<T> cells[SIZE]; ///< The slots.
+  };
+}
+
+#endif
+#endif
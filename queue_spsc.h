@@ -0,0 +1,304 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_QUEUE_SPSC__
+#define __ETL_QUEUE_SPSC__
+
+#include "platform.h"
+
+// Needs std::atomic.
+#if defined(ETL_CPP11_SUPPORTED)
+
+#include <stddef.h>
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "alignment.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup queue_spsc queue_spsc
+/// A fixed capacity queue for one producer thread and one consumer thread,
+/// without a lock. Requires C++11.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue_spsc
+  /// A fixed capacity, lock-free, single producer, single consumer queue.
+  /// push and emplace may only be called from one thread, and pop from one
+  /// other thread, at a time. The other members may be called from either,
+  /// but size, empty and full may be out of date as soon as they return.
+  /// The producer and consumer indexes count up without wrapping to the
+  /// capacity, and are masked to find a slot, so SIZE must be a power of two.
+  /// Each side keeps a copy of the other side's index and only reloads it
+  /// when the queue appears full or empty, so that the two threads rarely
+  /// read each other's cache line.
+  /// Items are only constructed while they are in the queue.
+  /// \tparam T    The type this queue should support.
+  /// \tparam SIZE The maximum capacity of the queue. A power of two.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class queue_spsc
+  {
+  public:
+
+    STATIC_ASSERT((SIZE > 0) && ((SIZE & (SIZE - 1)) == 0), "SIZE must be a power of two");
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+    typedef size_t   size_type;       ///< The type used for determining the size of the queue.
+
+  private:
+
+    typedef typename parameter_type<T>::type        parameter_t;
+    typedef typename rvalue_parameter_type<T>::type rvalue_parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    queue_spsc()
+      : write_index(0),
+        cached_read_index(0),
+        read_index(0),
+        cached_write_index(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Destroys any items still in the queue.
+    //*************************************************************************
+    ~queue_spsc()
+    {
+      while (pop())
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an item to the back of the queue. Producer only.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool push(parameter_t item)
+    {
+      return emplace(item);
+    }
+
+    //*************************************************************************
+    /// Moves an item to the back of the queue. Producer only.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    bool push(rvalue_parameter_t item)
+    {
+      return emplace(std::move(item));
+    }
+
+    //*************************************************************************
+    /// Constructs an item at the back of the queue. Producer only.
+    ///\return <b>true</b> if the item was added, <b>false</b> if the queue was full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&& ... args)
+    {
+      const size_t index = write_index.load(std::memory_order_relaxed);
+
+      if ((index - cached_read_index) == SIZE)
+      {
+        cached_read_index = read_index.load(std::memory_order_acquire);
+
+        if ((index - cached_read_index) == SIZE)
+        {
+          return false;
+        }
+      }
+
+      ::new (&p_buffer()[index & MASK]) T(std::forward<Args>(args)...);
+
+      // Publish the item.
+      write_index.store(index + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the item at the front of the queue to 'item' and removes it.
+    /// Consumer only.
+    ///\return <b>true</b> if an item was removed, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool pop(reference item)
+    {
+      const size_t index = read_index.load(std::memory_order_relaxed);
+
+      if (!readable(index))
+      {
+        return false;
+      }
+
+      T& slot = p_buffer()[index & MASK];
+
+      item = std::move(slot);
+      slot.~T();
+
+      // Hand the slot back to the producer.
+      read_index.store(index + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the item at the front of the queue. Consumer only.
+    ///\return <b>true</b> if an item was removed, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    bool pop()
+    {
+      const size_t index = read_index.load(std::memory_order_relaxed);
+
+      if (!readable(index))
+      {
+        return false;
+      }
+
+      p_buffer()[index & MASK].~T();
+
+      read_index.store(index + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the item at the front of the queue, or nullptr if
+    /// the queue is empty. The item stays in the queue until it is popped.
+    /// Consumer only.
+    //*************************************************************************
+    T* front()
+    {
+      const size_t index = read_index.load(std::memory_order_relaxed);
+
+      return readable(index) ? &p_buffer()[index & MASK] : nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      const size_t read  = read_index.load(std::memory_order_acquire);
+      const size_t write = write_index.load(std::memory_order_acquire);
+
+      return write - read;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return SIZE;
+    }
+
+  private:
+
+    static const size_t MASK = SIZE - 1;
+
+    //*************************************************************************
+    /// Checks that there is an item at 'index', reloading the producer's
+    /// index if the queue appears empty.
+    //*************************************************************************
+    bool readable(size_t index)
+    {
+      if (index == cached_write_index)
+      {
+        cached_write_index = write_index.load(std::memory_order_acquire);
+
+        if (index == cached_write_index)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    T* p_buffer()
+    {
+      return reinterpret_cast<T*>(&buffer);
+    }
+
+    // Disabled.
+    queue_spsc(const queue_spsc&);
+    queue_spsc& operator =(const queue_spsc&);
+
+    // Producer state.
+    std::atomic<size_t> write_index;       ///< The count of items pushed.
+    size_t              cached_read_index; ///< The producer's copy of read_index.
+    char                producer_padding[ETL_CACHE_LINE_SIZE];
+
+    // Consumer state.
+    std::atomic<size_t> read_index;         ///< The count of items popped.
+    size_t              cached_write_index; ///< The consumer's copy of write_index.
+    char                consumer_padding[ETL_CACHE_LINE_SIZE];
+
+    /// The storage for the items.
+    typename etl::aligned_storage<sizeof(T) * SIZE, etl::alignment_of<T>::value>::type buffer;
+  };
+}
+
+#endif
+#endif
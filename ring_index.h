@@ -0,0 +1,81 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_RING_INDEX__
+#define __ETL_RING_INDEX__
+
+#include <stddef.h>
+
+///\defgroup ring_index ring_index
+/// Index arithmetic for ring buffers with a size defined at compile time.
+/// \ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Moves indexes around a ring buffer of SIZE items.
+  /// When SIZE is a power of two the wrap around is a single AND with a
+  /// constant mask, otherwise it is a compare with the constant size.
+  ///\tparam SIZE The number of items in the buffer.
+  ///\ingroup ring_index
+  //***************************************************************************
+  template <const size_t SIZE, const bool IS_POWER_OF_2 = ((SIZE & (SIZE - 1)) == 0)>
+  struct ring_index
+  {
+    //*************************************************************************
+    /// The index 'n' after 'index'. 'n' must be no more than SIZE.
+    //*************************************************************************
+    static size_t add(size_t index, size_t n)
+    {
+      index += n;
+
+      return (index >= SIZE) ? index - SIZE : index;
+    }
+  };
+
+  //***************************************************************************
+  /// Moves indexes around a ring buffer of SIZE items, where SIZE is a power
+  /// of two.
+  ///\ingroup ring_index
+  //***************************************************************************
+  template <const size_t SIZE>
+  struct ring_index<SIZE, true>
+  {
+    static const size_t MASK = SIZE - 1;
+
+    //*************************************************************************
+    /// The index 'n' after 'index'.
+    //*************************************************************************
+    static size_t add(size_t index, size_t n)
+    {
+      return (index + n) & MASK;
+    }
+  };
+}
+
+#endif
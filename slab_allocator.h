@@ -0,0 +1,461 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_SLAB_ALLOCATOR__
+#define __ETL_SLAB_ALLOCATOR__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+
+#if defined(ETL_CPP11_SUPPORTED)
+#include <utility>
+#endif
+
+#include "ipool.h"
+#include "alignment.h"
+#include "log.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
+
+//*****************************************************************************
+///\defgroup slab_allocator slab_allocator
+/// A fixed capacity allocator of variable sized blocks.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace __private_slab_allocator__
+  {
+    //*************************************************************************
+    /// A pool of untyped blocks of one size.
+    //*************************************************************************
+    class slab : public pool_base
+    {
+    public:
+
+      slab(char* p_buffer, uint32_t* p_free_map, size_t n_blocks, size_t block_size)
+        : pool_base(p_free_map, n_blocks),
+          p_buffer(p_buffer),
+          block_size(block_size)
+      {
+      }
+
+      //***********************************************************************
+      /// Allocates a block, or returns nullptr if there are none free.
+      /// A full slab counts a failure, even if a larger slab serves the request.
+      //***********************************************************************
+      void* allocate()
+      {
+        if (items_allocated != MAX_SIZE)
+        {
+          return p_buffer + (take_free_index() * block_size);
+        }
+
+        record_failure();
+
+        return nullptr;
+      }
+
+      //***********************************************************************
+      /// Releases a block. The block must belong to this slab.
+      //***********************************************************************
+      void release(const void* p_block)
+      {
+        return_free_index(static_cast<size_t>(static_cast<const char*>(p_block) - p_buffer) / block_size);
+      }
+
+      //***********************************************************************
+      /// Checks to see if the block belongs to this slab.
+      //***********************************************************************
+      bool is_in_slab(const void* p_block) const
+      {
+        const char* p = static_cast<const char*>(p_block);
+
+        return (p >= p_buffer) && (p < (p_buffer + (MAX_SIZE * block_size)));
+      }
+
+    private:
+
+      char* const  p_buffer;
+      const size_t block_size;
+    };
+  }
+
+  //*************************************************************************
+  /// The size independent base of a slab allocator.
+  /// Blocks come from one pool per power of two size class, from the
+  /// minimum block size up to the maximum. The class for a size is found
+  /// from its highest set bit. If the class is full, the next larger class
+  /// with a free block is used, so the search is bounded by the number of
+  /// classes.
+  ///\ingroup slab_allocator
+  //*************************************************************************
+  class islab_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// Allocates a block of at least 'size' bytes.
+    /// If ETL_THROW_EXCEPTIONS is defined and the size is larger than the
+    /// maximum block size or there are no free blocks large enough, an
+    /// etl::pool_no_allocation is thrown, otherwise a nullptr is returned.
+    /// The block is aligned to the smaller of its size and the largest
+    /// fundamental alignment.
+    //*************************************************************************
+    void* allocate(size_t size)
+    {
+      if (size <= max_block_size())
+      {
+        for (size_t i = class_index(size); i < n_classes; ++i)
+        {
+          void* p_block = p_slabs[i].allocate();
+
+          if (p_block != nullptr)
+          {
+            return p_block;
+          }
+        }
+      }
+
+#ifdef ETL_THROW_EXCEPTIONS
+      throw pool_no_allocation();
+#else
+      error_handler::error(pool_no_allocation());
+#endif
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Releases a block.
+    /// If ETL_THROW_EXCEPTIONS is defined and the block does not belong to this
+    /// allocator then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void release(const void* p_block)
+    {
+      for (size_t i = 0; i < n_classes; ++i)
+      {
+        if (p_slabs[i].is_in_slab(p_block))
+        {
+          p_slabs[i].release(p_block);
+          return;
+        }
+      }
+
+#ifdef ETL_THROW_EXCEPTIONS
+      throw pool_object_not_in_pool();
+#else
+      error_handler::error(pool_object_not_in_pool());
+#endif
+    }
+
+    //*************************************************************************
+    /// Checks to see if the block belongs to this allocator.
+    //*************************************************************************
+    bool is_in_pool(const void* p_block) const
+    {
+      for (size_t i = 0; i < n_classes; ++i)
+      {
+        if (p_slabs[i].is_in_slab(p_block))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free blocks in the size class for 'size'.
+    //*************************************************************************
+    size_t available(size_t size) const
+    {
+      return (size <= max_block_size()) ? p_slabs[class_index(size)].available() : 0;
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns a snapshot of the statistics of the size class for 'size'.
+    /// 'size' must not exceed the maximum block size.
+    //*************************************************************************
+    pool_statistics get_statistics(size_t size) const
+    {
+      return p_slabs[class_index(size)].get_statistics();
+    }
+
+    //*************************************************************************
+    /// Clears the statistics of every size class.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0; i < n_classes; ++i)
+      {
+        p_slabs[i].reset_statistics();
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns the largest size that may be allocated.
+    //*************************************************************************
+    size_t max_block_size() const
+    {
+      return size_t(1) << (min_block_log2 + n_classes - 1);
+    }
+
+  protected:
+
+    typedef __private_slab_allocator__::slab slab;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_buffer        The block storage. Each class takes 'n_blocks' blocks in turn, largest first.
+    ///\param p_free_maps     The free maps. Each class takes 'free_map_words' words in turn.
+    ///\param free_map_words  The number of free map words per class.
+    ///\param p_slab_storage  Uninitialised storage for 'n_classes' slabs.
+    ///\param n_classes       The number of size classes.
+    ///\param min_block_log2  The log2 of the smallest block size.
+    ///\param n_blocks        The number of blocks per class.
+    //*************************************************************************
+    islab_allocator(char*     p_buffer,
+                    uint32_t* p_free_maps,
+                    size_t    free_map_words,
+                    void*     p_slab_storage,
+                    size_t    n_classes,
+                    size_t    min_block_log2,
+                    size_t    n_blocks)
+      : p_slabs(static_cast<slab*>(p_slab_storage)),
+        n_classes(n_classes),
+        min_block_log2(min_block_log2)
+    {
+      // The largest blocks come first, so that every class starts at a
+      // multiple of its own block size, whatever the number of blocks.
+      for (size_t i = n_classes; i-- > 0;)
+      {
+        const size_t block_size = size_t(1) << (min_block_log2 + i);
+
+        ::new (&p_slabs[i]) slab(p_buffer, p_free_maps + (i * free_map_words), n_blocks, block_size);
+
+        p_buffer += n_blocks * block_size;
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The size class for a size, which must not exceed the maximum block size.
+    //*************************************************************************
+    size_t class_index(size_t size) const
+    {
+      if (size <= (size_t(1) << min_block_log2))
+      {
+        return 0;
+      }
+
+      return __private_pool__::highest_set_bit(static_cast<uint32_t>(size - 1)) + 1 - min_block_log2;
+    }
+
+    // Disabled.
+    islab_allocator(const islab_allocator&);
+    islab_allocator& operator =(const islab_allocator&);
+
+    slab* const  p_slabs;
+    const size_t n_classes;
+    const size_t min_block_log2;
+  };
+
+  //*************************************************************************
+  /// A slab allocator with BLOCKS_PER_CLASS blocks in each power of two
+  /// size class from MIN_BLOCK_SIZE to MAX_BLOCK_SIZE.
+  ///\tparam MIN_BLOCK_SIZE   The smallest block size. A power of two.
+  ///\tparam MAX_BLOCK_SIZE   The largest block size. A power of two.
+  ///\tparam BLOCKS_PER_CLASS The number of blocks of each size.
+  ///\ingroup slab_allocator
+  //*************************************************************************
+  template <const size_t MIN_BLOCK_SIZE, const size_t MAX_BLOCK_SIZE, const size_t BLOCKS_PER_CLASS>
+  class slab_allocator : public islab_allocator
+  {
+  public:
+
+    STATIC_ASSERT(((MIN_BLOCK_SIZE & (MIN_BLOCK_SIZE - 1)) == 0) &&
+                  ((MAX_BLOCK_SIZE & (MAX_BLOCK_SIZE - 1)) == 0) &&
+                  (MIN_BLOCK_SIZE > 0) && (MIN_BLOCK_SIZE <= MAX_BLOCK_SIZE) && (MAX_BLOCK_SIZE <= 0x80000000UL),
+                  "Block sizes must be powers of two with MIN_BLOCK_SIZE <= MAX_BLOCK_SIZE <= 2^31");
+
+    static const size_t N_CLASSES = etl::log2<MAX_BLOCK_SIZE>::value - etl::log2<MIN_BLOCK_SIZE>::value + 1;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    slab_allocator()
+      : islab_allocator(reinterpret_cast<char*>(&buffer),
+                        &free_maps[0][0],
+                        FREE_MAP_WORDS,
+                        &slabs,
+                        N_CLASSES,
+                        etl::log2<MIN_BLOCK_SIZE>::value,
+                        BLOCKS_PER_CLASS)
+    {
+    }
+
+  private:
+
+    static const size_t FREE_MAP_WORDS = __private_pool__::free_map_words<BLOCKS_PER_CLASS>::value;
+
+    // The sum of the block sizes is 2 * MAX_BLOCK_SIZE - MIN_BLOCK_SIZE.
+    static const size_t BUFFER_SIZE = BLOCKS_PER_CLASS * ((2 * MAX_BLOCK_SIZE) - MIN_BLOCK_SIZE);
+
+    /// The storage for the blocks.
+    typename etl::aligned_storage<BUFFER_SIZE, etl::alignment_of<long double>::value>::type buffer;
+
+    uint32_t free_maps[N_CLASSES][FREE_MAP_WORDS]; ///< The free maps for each class.
+
+    /// The storage for the slabs.
+    typename etl::aligned_storage<sizeof(slab) * N_CLASSES, etl::alignment_of<slab>::value>::type slabs;
+  };
+
+  //*************************************************************************
+  /// An allocator for the standard containers that draws from a slab allocator.
+  /// Errors are reported as by islab_allocator::allocate.
+  ///\ingroup slab_allocator
+  //*************************************************************************
+  template <typename T>
+  class slab_std_allocator
+  {
+  public:
+
+    typedef T              value_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef size_t         size_type;
+    typedef ptrdiff_t      difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef slab_std_allocator<U> other;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit slab_std_allocator(islab_allocator& slabs)
+      : p_slabs(&slabs)
+    {
+    }
+
+    //*************************************************************************
+    /// Converting constructor.
+    //*************************************************************************
+    template <typename U>
+    slab_std_allocator(const slab_std_allocator<U>& other)
+      : p_slabs(other.p_slabs)
+    {
+    }
+
+    pointer address(reference value) const
+    {
+      return &value;
+    }
+
+    const_pointer address(const_reference value) const
+    {
+      return &value;
+    }
+
+    pointer allocate(size_type n, const void* = 0)
+    {
+      return static_cast<pointer>(p_slabs->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type)
+    {
+      p_slabs->release(p);
+    }
+
+    size_type max_size() const
+    {
+      return p_slabs->max_block_size() / sizeof(T);
+    }
+
+#if defined(ETL_CPP11_SUPPORTED)
+    template <typename U, typename ... Args>
+    void construct(U* p, Args&& ... args)
+    {
+      ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p)
+    {
+      p->~U();
+    }
+#else
+    void construct(pointer p, const_reference value)
+    {
+      ::new (static_cast<void*>(p)) T(value);
+    }
+
+    void destroy(pointer p)
+    {
+      p->~T();
+    }
+#endif
+
+    template <typename U>
+    bool operator ==(const slab_std_allocator<U>& other) const
+    {
+      return p_slabs == other.p_slabs;
+    }
+
+    template <typename U>
+    bool operator !=(const slab_std_allocator<U>& other) const
+    {
+      return p_slabs != other.p_slabs;
+    }
+
+  private:
+
+    template <typename U>
+    friend class slab_std_allocator;
+
+    islab_allocator* p_slabs;
+  };
+}
+
+#endif
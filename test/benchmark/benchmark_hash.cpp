@@ -0,0 +1,439 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput benchmarks for the CRC, FNV, checksum and hash classes.
+// Each engine hashes keys of 8 bytes to 64 MB. The results are written to
+// stdout as JSON, in the layout used by Google Benchmark, so that runs may be
+// compared with its tools or a simple diff.
+//
+// usage: benchmark_hash [--filter text] [--min_time seconds] [--max_size bytes]
+//
+// Build, for example, with:
+//   g++ -std=c++11 -O2 -march=native -DCOMPILER_GCC -DPLATFORM_LINUX -I../.. benchmark_hash.cpp -o benchmark_hash
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../crc8_ccitt.h"
+#include "../../crc16.h"
+#include "../../crc16_ccitt.h"
+#include "../../crc16_kermit.h"
+#include "../../crc32.h"
+#include "../../crc32_c.h"
+#include "../../crc64_ecma.h"
+#include "../../fnv_1.h"
+#include "../../fnv_1_batch.h"
+#include "../../xxhash64.h"
+#include "../../checksum.h"
+#include "../../internet_checksum.h"
+#include "../../fletcher16.h"
+#include "../../fletcher32.h"
+#include "../../adler32.h"
+#include "../../hash.h"
+
+namespace
+{
+  const size_t MIN_SIZE = 8;
+  const size_t MAX_SIZE = 64 * 1024 * 1024;
+
+  //***************************************************************************
+  // Options and shared state.
+  //***************************************************************************
+  struct options
+  {
+    std::string filter;
+    double      min_time = 0.2;
+    size_t      max_size = MAX_SIZE;
+  };
+
+  options              settings;
+  std::vector<uint8_t> data;
+  bool                 first_result = true;
+
+  // Stops the compiler discarding the results.
+  volatile uint64_t sink;
+
+  //***************************************************************************
+  // Writes one result.
+  //***************************************************************************
+  void report(const std::string& name, uint64_t iterations, double seconds, size_t bytes_per_iteration)
+  {
+    const double ns_per_iteration = (seconds * 1e9) / double(iterations);
+
+    printf("%s    {\n", first_result ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", name.c_str());
+    printf("      \"iterations\": %llu,\n", static_cast<unsigned long long>(iterations));
+    printf("      \"real_time\": %.3f,\n", ns_per_iteration);
+    printf("      \"time_unit\": \"ns\",\n");
+    printf("      \"bytes\": %llu,\n", static_cast<unsigned long long>(bytes_per_iteration));
+    printf("      \"bytes_per_second\": %.0f,\n", (double(bytes_per_iteration) * double(iterations)) / seconds);
+    printf("      \"items_per_second\": %.0f\n", double(iterations) / seconds);
+    printf("    }");
+
+    fflush(stdout);
+    fprintf(stderr, "%-40s %12.1f ns %10.1f MB/s\n", name.c_str(), ns_per_iteration,
+            (double(bytes_per_iteration) * double(iterations)) / (seconds * 1024.0 * 1024.0));
+
+    first_result = false;
+  }
+
+  bool selected(const std::string& name)
+  {
+    return settings.filter.empty() || (name.find(settings.filter) != std::string::npos);
+  }
+
+  //***************************************************************************
+  // Runs 'function(i)' for increasing numbers of iterations until the
+  // run takes at least the minimum time.
+  //***************************************************************************
+  template <typename TFunction>
+  void measure(const std::string& name, size_t bytes_per_iteration, TFunction function)
+  {
+    if (!selected(name))
+    {
+      return;
+    }
+
+    uint64_t iterations = 1;
+
+    for (;;)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      uint64_t result = 0;
+
+      for (uint64_t i = 0; i < iterations; ++i)
+      {
+        result += function(size_t(i));
+      }
+
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      sink = sink + result;
+
+      if ((seconds >= settings.min_time) || (iterations >= (uint64_t(1) << 40)))
+      {
+        report(name, iterations, seconds, bytes_per_iteration);
+        return;
+      }
+
+      // Aim a little past the minimum time on the next pass.
+      double scale = (seconds > 0.0) ? (1.4 * settings.min_time) / seconds : 100.0;
+
+      if (scale > 100.0)
+      {
+        scale = 100.0;
+      }
+
+      uint64_t next = uint64_t(double(iterations) * scale);
+      iterations = (next > iterations) ? next : iterations + 1;
+    }
+  }
+
+  //***************************************************************************
+  // The start of key 'i' of a given size, stepping through the buffer so
+  // that short keys are not all the same.
+  //***************************************************************************
+  const uint8_t* key(size_t i, size_t size)
+  {
+    const size_t positions = (MAX_SIZE - size) / size + 1;
+
+    return data.data() + ((i % positions) * size);
+  }
+
+  //***************************************************************************
+  // The key sizes: powers of eight from 8 bytes, then the maximum size.
+  //***************************************************************************
+  std::vector<size_t> key_sizes()
+  {
+    std::vector<size_t> sizes;
+
+    for (size_t size = 8; size < settings.max_size; size *= 8)
+    {
+      sizes.push_back(size);
+    }
+
+    sizes.push_back(settings.max_size);
+
+    return sizes;
+  }
+
+  //***************************************************************************
+  // Benchmarks a hash, CRC or checksum class over each key size.
+  //***************************************************************************
+  template <typename THash>
+  void range_benchmark(const char* name)
+  {
+    std::vector<size_t> sizes = key_sizes();
+
+    for (size_t s = 0; s < sizes.size(); ++s)
+    {
+      const size_t size = sizes[s];
+
+      measure(std::string(name) + "/" + std::to_string(size), size, [size](size_t i)
+      {
+        const uint8_t* p = key(i, size);
+
+        return uint64_t(THash(p, p + size).value());
+      });
+    }
+  }
+
+  //***************************************************************************
+  // Benchmarks hash_range with a policy over each key size.
+  //***************************************************************************
+  template <typename TPolicy>
+  void hash_range_benchmark(const char* name)
+  {
+    std::vector<size_t> sizes = key_sizes();
+
+    for (size_t s = 0; s < sizes.size(); ++s)
+    {
+      const size_t size = sizes[s];
+
+      measure(std::string(name) + "/" + std::to_string(size), size, [size](size_t i)
+      {
+        const uint8_t* p = key(i, size);
+
+        return uint64_t(etl::hash_range<TPolicy>(p, p + size));
+      });
+    }
+  }
+
+  //***************************************************************************
+  // Benchmarks the batched FNV-1a, a thousand keys per batch.
+  //***************************************************************************
+  template <typename THash>
+  void batch_benchmark(const char* name, void (*batch)(const uint8_t*, size_t, size_t, THash*))
+  {
+    const size_t KEYS = 1000;
+
+    std::vector<THash> hashes(KEYS);
+
+    for (size_t size = 8; (size * KEYS) <= settings.max_size; size *= 8)
+    {
+      measure(std::string(name) + "/" + std::to_string(size), size * KEYS, [size, batch, &hashes](size_t i)
+      {
+        const uint8_t* p = data.data() + ((i % (MAX_SIZE / (size * KEYS))) * size * KEYS);
+
+        batch(p, size, KEYS, hashes.data());
+
+        return uint64_t(hashes[KEYS - 1]);
+      });
+    }
+  }
+
+  //***************************************************************************
+  // Makes a value of T from the bytes of a key.
+  //***************************************************************************
+  template <typename T>
+  T make_value(const uint8_t* p)
+  {
+    T value;
+    memcpy(&value, p, sizeof(T));
+    return value;
+  }
+
+  template <>
+  bool make_value<bool>(const uint8_t* p)
+  {
+    return (*p & 1) != 0;
+  }
+
+  template <>
+  int* make_value<int*>(const uint8_t* p)
+  {
+    uintptr_t value;
+    memcpy(&value, p, sizeof(value));
+    return reinterpret_cast<int*>(value);
+  }
+
+  template <>
+  long double make_value<long double>(const uint8_t* p)
+  {
+    double value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+  }
+
+  //***************************************************************************
+  // Benchmarks an etl::hash specialisation.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  void hash_benchmark(const char* type_name, const char* policy_name)
+  {
+    measure(std::string("hash<") + type_name + ", " + policy_name + ">", sizeof(T), [](size_t i)
+    {
+      return uint64_t(etl::hash<T, TPolicy>()(make_value<T>(key(i, 16))));
+    });
+  }
+
+  template <typename TPolicy>
+  void hash_benchmarks(const char* policy_name)
+  {
+    hash_benchmark<bool,               TPolicy>("bool",               policy_name);
+    hash_benchmark<char,               TPolicy>("char",               policy_name);
+    hash_benchmark<signed char,        TPolicy>("signed char",        policy_name);
+    hash_benchmark<unsigned char,      TPolicy>("unsigned char",      policy_name);
+    hash_benchmark<wchar_t,            TPolicy>("wchar_t",            policy_name);
+    hash_benchmark<short,              TPolicy>("short",              policy_name);
+    hash_benchmark<unsigned short,     TPolicy>("unsigned short",     policy_name);
+    hash_benchmark<int,                TPolicy>("int",                policy_name);
+    hash_benchmark<unsigned int,       TPolicy>("unsigned int",       policy_name);
+    hash_benchmark<long,               TPolicy>("long",               policy_name);
+    hash_benchmark<unsigned long,      TPolicy>("unsigned long",      policy_name);
+    hash_benchmark<long long,          TPolicy>("long long",          policy_name);
+    hash_benchmark<unsigned long long, TPolicy>("unsigned long long", policy_name);
+    hash_benchmark<float,              TPolicy>("float",              policy_name);
+    hash_benchmark<double,             TPolicy>("double",             policy_name);
+    hash_benchmark<long double,        TPolicy>("long double",        policy_name);
+    hash_benchmark<int*,               TPolicy>("int*",               policy_name);
+  }
+
+  //***************************************************************************
+  // Writes the run context.
+  //***************************************************************************
+  void write_context(const char* executable)
+  {
+    char date[64];
+    time_t now = time(0);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    std::string features;
+#if defined(__SSE4_2__)
+    features += " sse4.2";
+#endif
+#if defined(__AVX2__)
+    features += " avx2";
+#endif
+
+    printf("{\n");
+    printf("  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"executable\": \"%s\",\n", executable);
+    printf("    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    printf("    \"library\": \"etl\",\n");
+    printf("    \"features\": \"%s\",\n", features.empty() ? "" : features.c_str() + 1);
+    printf("    \"min_time\": %g\n", settings.min_time);
+    printf("  },\n");
+    printf("  \"benchmarks\": [\n");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+    {
+      settings.filter = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--min_time") == 0) && ((i + 1) < argc))
+    {
+      settings.min_time = atof(argv[++i]);
+    }
+    else if ((strcmp(argv[i], "--max_size") == 0) && ((i + 1) < argc))
+    {
+      settings.max_size = size_t(strtoull(argv[++i], 0, 0));
+
+      if (settings.max_size < MIN_SIZE)
+      {
+        settings.max_size = MIN_SIZE;
+      }
+      else if (settings.max_size > MAX_SIZE)
+      {
+        settings.max_size = MAX_SIZE;
+      }
+    }
+    else
+    {
+      fprintf(stderr, "usage: benchmark_hash [--filter text] [--min_time seconds] [--max_size bytes]\n");
+      return 2;
+    }
+  }
+
+  data.resize(MAX_SIZE);
+
+  uint32_t state = 0x12345678;
+
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    state   = (state * 1664525) + 1013904223;
+    data[i] = uint8_t(state >> 24);
+  }
+
+  write_context(argv[0]);
+
+  range_benchmark<etl::crc8_ccitt<> >("crc8_ccitt");
+  range_benchmark<etl::crc8_ccitt<etl::endian::little, etl::crc_slice_by_8> >("crc8_ccitt_slice_by_8");
+  range_benchmark<etl::crc16<> >("crc16");
+  range_benchmark<etl::crc16<etl::endian::little, etl::crc_slice_by_8> >("crc16_slice_by_8");
+  range_benchmark<etl::crc16_ccitt<> >("crc16_ccitt");
+  range_benchmark<etl::crc16_ccitt<etl::endian::little, etl::crc_slice_by_8> >("crc16_ccitt_slice_by_8");
+  range_benchmark<etl::crc16_kermit<> >("crc16_kermit");
+  range_benchmark<etl::crc16_kermit<etl::endian::little, etl::crc_slice_by_8> >("crc16_kermit_slice_by_8");
+  range_benchmark<etl::crc32<> >("crc32");
+  range_benchmark<etl::crc32<etl::endian::little, etl::crc_slice_by_8> >("crc32_slice_by_8");
+  range_benchmark<etl::crc32<etl::endian::little, etl::crc_hardware> >("crc32_hardware");
+  range_benchmark<etl::crc32_c<> >("crc32_c");
+  range_benchmark<etl::crc32_c<etl::endian::little, etl::crc_slice_by_8> >("crc32_c_slice_by_8");
+  range_benchmark<etl::crc32_c<etl::endian::little, etl::crc_hardware> >("crc32_c_hardware");
+  range_benchmark<etl::crc64_ecma<> >("crc64_ecma");
+  range_benchmark<etl::crc64_ecma<etl::endian::little, etl::crc_slice_by_8> >("crc64_ecma_slice_by_8");
+  range_benchmark<etl::crc64_ecma<etl::endian::little, etl::crc_hardware> >("crc64_ecma_hardware");
+
+  range_benchmark<etl::fnv_1_32<> >("fnv_1_32");
+  range_benchmark<etl::fnv_1a_32<> >("fnv_1a_32");
+  range_benchmark<etl::fnv_1_64<> >("fnv_1_64");
+  range_benchmark<etl::fnv_1a_64<> >("fnv_1a_64");
+  batch_benchmark<uint32_t>("fnv_1a_32_batch", etl::fnv_1a_32_batch);
+  batch_benchmark<uint64_t>("fnv_1a_64_batch", etl::fnv_1a_64_batch);
+  range_benchmark<etl::xxhash64<> >("xxhash64");
+
+  range_benchmark<etl::checksum<uint32_t> >("checksum");
+  range_benchmark<etl::internet_checksum<> >("internet_checksum");
+  range_benchmark<etl::fletcher16<> >("fletcher16");
+  range_benchmark<etl::fletcher32<> >("fletcher32");
+  range_benchmark<etl::adler32<> >("adler32");
+
+  hash_range_benchmark<etl::hash_policy_fnv_1a>("hash_range<fnv_1a>");
+  hash_range_benchmark<etl::hash_policy_xxhash64>("hash_range<xxhash64>");
+  hash_benchmarks<etl::hash_policy_fnv_1a>("fnv_1a");
+  hash_benchmarks<etl::hash_policy_xxhash64>("xxhash64");
+
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
@@ -0,0 +1,290 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Multithreaded throughput benchmarks for the pools.
+// Each thread repeatedly allocates a few items and releases them. The
+// pools compared are etl::pool behind a mutex, etl::concurrent_pool, and
+// etl::concurrent_pool with a per-thread cache. The results are written to
+// stdout as JSON, in the layout used by Google Benchmark.
+//
+// usage: benchmark_pool [--filter text] [--min_time seconds] [--max_threads n]
+//
+// Build, for example, with:
+//   g++ -std=c++11 -O2 -DCOMPILER_GCC -DPLATFORM_LINUX -DETL_THROW_EXCEPTIONS -I../.. benchmark_pool.cpp -o benchmark_pool -pthread
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../pool.h"
+#include "../../concurrent_pool.h"
+
+namespace
+{
+  const size_t N_HELD    = 4;
+  const size_t POOL_SIZE = 1024;
+
+  struct Item
+  {
+    uint64_t data[4];
+  };
+
+  //***************************************************************************
+  // Options and shared state.
+  //***************************************************************************
+  struct options
+  {
+    std::string filter;
+    double      min_time    = 0.2;
+    size_t      max_threads = 0;
+  };
+
+  options settings;
+  bool    first_result = true;
+
+  //***************************************************************************
+  // Writes one result.
+  //***************************************************************************
+  void report(const std::string& name, uint64_t iterations, double seconds, size_t threads)
+  {
+    const double ns_per_iteration = (seconds * 1e9 * double(threads)) / double(iterations);
+
+    printf("%s    {\n", first_result ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", name.c_str());
+    printf("      \"iterations\": %llu,\n", static_cast<unsigned long long>(iterations));
+    printf("      \"real_time\": %.3f,\n", ns_per_iteration);
+    printf("      \"time_unit\": \"ns\",\n");
+    printf("      \"threads\": %llu,\n", static_cast<unsigned long long>(threads));
+    printf("      \"items_per_second\": %.0f\n", double(iterations) / seconds);
+    printf("    }");
+
+    fflush(stdout);
+    fprintf(stderr, "%-40s %12.1f ns %10.2f M/s\n", name.c_str(), ns_per_iteration, double(iterations) / (seconds * 1e6));
+
+    first_result = false;
+  }
+
+  bool selected(const std::string& name)
+  {
+    return settings.filter.empty() || (name.find(settings.filter) != std::string::npos);
+  }
+
+  //***************************************************************************
+  // Runs 'function(thread, stop, count)' on a number of threads for the
+  // minimum time. Each thread adds its iterations to 'count'.
+  // An iteration is one allocation and one release.
+  //***************************************************************************
+  template <typename TFunction>
+  void measure(const std::string& name, size_t threads, TFunction function)
+  {
+    if (!selected(name))
+    {
+      return;
+    }
+
+    std::atomic<bool>     start(false);
+    std::atomic<bool>     stop(false);
+    std::atomic<uint64_t> iterations(0);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; ++t)
+    {
+      workers.push_back(std::thread([&, t]()
+      {
+        uint64_t count = 0;
+
+        while (!start.load(std::memory_order_acquire))
+        {
+        }
+
+        function(t, stop, count);
+
+        iterations += count;
+      }));
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(settings.min_time));
+    stop.store(true, std::memory_order_relaxed);
+
+    for (size_t t = 0; t < threads; ++t)
+    {
+      workers[t].join();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    report(name, iterations, seconds, threads);
+  }
+
+  //***************************************************************************
+  // Allocates and releases N_HELD items until stopped.
+  //***************************************************************************
+  template <typename TAllocate, typename TRelease>
+  void churn(std::atomic<bool>& stop, uint64_t& count, TAllocate allocate, TRelease release)
+  {
+    Item* held[N_HELD];
+
+    while (!stop.load(std::memory_order_relaxed))
+    {
+      for (size_t i = 0; i < N_HELD; ++i)
+      {
+        held[i] = allocate();
+        held[i]->data[0] = i;
+      }
+
+      for (size_t i = 0; i < N_HELD; ++i)
+      {
+        release(held[i]);
+      }
+
+      count += N_HELD;
+    }
+  }
+
+  //***************************************************************************
+  // The pools, for a number of threads.
+  //***************************************************************************
+  void pool_benchmarks(size_t threads)
+  {
+    const std::string suffix = "/threads:" + std::to_string(threads);
+
+    {
+      etl::pool<Item, POOL_SIZE> pool;
+      std::mutex lock;
+
+      measure("pool+mutex" + suffix, threads, [&](size_t, std::atomic<bool>& stop, uint64_t& count)
+      {
+        churn(stop, count,
+              [&]() { std::lock_guard<std::mutex> guard(lock); return pool.allocate(); },
+              [&](Item* p) { std::lock_guard<std::mutex> guard(lock); pool.release(p); });
+      });
+    }
+
+    {
+      etl::concurrent_pool<Item, POOL_SIZE> pool;
+
+      measure("concurrent_pool" + suffix, threads, [&](size_t, std::atomic<bool>& stop, uint64_t& count)
+      {
+        churn(stop, count,
+              [&]() { return pool.allocate(); },
+              [&](Item* p) { pool.release(p); });
+      });
+    }
+
+    {
+      typedef etl::concurrent_pool<Item, POOL_SIZE> Pool;
+      Pool pool;
+
+      measure("concurrent_pool+cache<16>" + suffix, threads, [&](size_t, std::atomic<bool>& stop, uint64_t& count)
+      {
+        Pool::cache<16> cache(pool);
+
+        churn(stop, count,
+              [&]() { return cache.allocate(); },
+              [&](Item* p) { cache.release(p); });
+      });
+    }
+  }
+
+  //***************************************************************************
+  // Writes the run context.
+  //***************************************************************************
+  void write_context(const char* executable)
+  {
+    char date[64];
+    time_t now = time(0);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    printf("{\n");
+    printf("  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"executable\": \"%s\",\n", executable);
+    printf("    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    printf("    \"library\": \"etl\",\n");
+    printf("    \"min_time\": %g\n", settings.min_time);
+    printf("  },\n");
+    printf("  \"benchmarks\": [\n");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+    {
+      settings.filter = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--min_time") == 0) && ((i + 1) < argc))
+    {
+      settings.min_time = atof(argv[++i]);
+    }
+    else if ((strcmp(argv[i], "--max_threads") == 0) && ((i + 1) < argc))
+    {
+      settings.max_threads = size_t(strtoull(argv[++i], 0, 0));
+    }
+    else
+    {
+      fprintf(stderr, "usage: benchmark_pool [--filter text] [--min_time seconds] [--max_threads n]\n");
+      return 2;
+    }
+  }
+
+  if (settings.max_threads == 0)
+  {
+    settings.max_threads = std::thread::hardware_concurrency();
+
+    if (settings.max_threads == 0)
+    {
+      settings.max_threads = 4;
+    }
+  }
+
+  write_context(argv[0]);
+
+  for (size_t threads = 1; threads <= settings.max_threads; threads *= 2)
+  {
+    pool_benchmarks(threads);
+  }
+
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
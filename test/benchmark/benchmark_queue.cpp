@@ -0,0 +1,489 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Inter-thread throughput benchmarks for the queues.
+// A producer thread pushes a sequence of small items and a consumer thread
+// pops them. The queues compared are etl::queue behind a mutex and
+// etl::queue_spsc.
+// The contention benchmarks run from 1 to 16 producers, each with a consumer,
+// (2 to 32 threads) on etl::queue behind a mutex and on etl::queue_mpmc,
+// pushing and popping one item at a time or in batches.
+// The results are written to stdout as JSON, in the layout used by
+// Google Benchmark.
+// With fewer than two CPUs the threads take turns, and the results mostly
+// measure the scheduler.
+//
+// usage: benchmark_queue [--filter text] [--min_time seconds]
+//
+// Build, for example, with:
+//   g++ -std=c++11 -O2 -DCOMPILER_GCC -DPLATFORM_LINUX -DETL_THROW_EXCEPTIONS -I../.. benchmark_queue.cpp -o benchmark_queue -pthread
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../queue.h"
+#include "../../queue_spsc.h"
+#include "../../queue_mpmc.h"
+
+namespace
+{
+  const size_t QUEUE_SIZE = 1024;
+  const size_t BATCH_SIZE = 16;
+
+  //***************************************************************************
+  // Options and shared state.
+  //***************************************************************************
+  struct options
+  {
+    std::string filter;
+    double      min_time = 0.2;
+  };
+
+  options settings;
+  bool    first_result = true;
+
+  // Stops the compiler discarding the results.
+  volatile uint64_t sink;
+
+  //***************************************************************************
+  // Writes one result.
+  //***************************************************************************
+  void report(const std::string& name, uint64_t items, double seconds)
+  {
+    const double ns_per_item = (seconds * 1e9) / double(items);
+
+    printf("%s    {\n", first_result ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", name.c_str());
+    printf("      \"iterations\": %llu,\n", static_cast<unsigned long long>(items));
+    printf("      \"real_time\": %.3f,\n", ns_per_item);
+    printf("      \"time_unit\": \"ns\",\n");
+    printf("      \"items_per_second\": %.0f\n", double(items) / seconds);
+    printf("    }");
+
+    fflush(stdout);
+    fprintf(stderr, "%-40s %12.2f ns %10.1f M/s\n", name.c_str(), ns_per_item, double(items) / (seconds * 1e6));
+
+    first_result = false;
+  }
+
+  bool selected(const std::string& name)
+  {
+    return settings.filter.empty() || (name.find(settings.filter) != std::string::npos);
+  }
+
+  //***************************************************************************
+  // Runs 'function(items)' for increasing numbers of items until the run
+  // takes at least the minimum time.
+  //***************************************************************************
+  template <typename TFunction>
+  void measure(const std::string& name, TFunction function)
+  {
+    if (!selected(name))
+    {
+      return;
+    }
+
+    uint64_t items = 1024;
+
+    for (;;)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      sink = sink + function(items);
+
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      if ((seconds >= settings.min_time) || (items >= (uint64_t(1) << 40)))
+      {
+        report(name, items, seconds);
+        return;
+      }
+
+      // Aim a little past the minimum time on the next pass.
+      double scale = (seconds > 0.0) ? (1.4 * settings.min_time) / seconds : 100.0;
+
+      if (scale > 100.0)
+      {
+        scale = 100.0;
+      }
+
+      uint64_t next = uint64_t(double(items) * scale);
+      items = (next > items) ? next : items + 1;
+    }
+  }
+
+  //***************************************************************************
+  // Spins for a while, then yields, so that the benchmark still progresses
+  // when there are fewer CPUs than threads.
+  //***************************************************************************
+  class backoff
+  {
+  public:
+
+    backoff()
+      : spins(0)
+    {
+    }
+
+    void operator ()()
+    {
+      if (++spins == 256)
+      {
+        spins = 0;
+        std::this_thread::yield();
+      }
+    }
+
+  private:
+
+    unsigned spins;
+  };
+
+  //***************************************************************************
+  // Passes 'items' values from a producer thread to this thread.
+  // 'push' and 'pop' return false when the queue is full or empty.
+  // Returns the sum of the values popped.
+  //***************************************************************************
+  template <typename TPush, typename TPop>
+  uint64_t transfer(uint64_t items, TPush push, TPop pop)
+  {
+    std::thread producer([items, &push]()
+    {
+      for (uint64_t i = 0; i < items; ++i)
+      {
+        backoff wait;
+
+        while (!push(i))
+        {
+          wait();
+        }
+      }
+    });
+
+    uint64_t sum = 0;
+    uint64_t value;
+
+    for (uint64_t i = 0; i < items; ++i)
+    {
+      backoff wait;
+
+      while (!pop(value))
+      {
+        wait();
+      }
+
+      sum += value;
+    }
+
+    producer.join();
+
+    return sum;
+  }
+
+  //***************************************************************************
+  // The single producer, single consumer queues.
+  //***************************************************************************
+  void spsc_benchmarks()
+  {
+    measure("queue+mutex/spsc", [](uint64_t items)
+    {
+      etl::queue<uint64_t, QUEUE_SIZE> queue;
+      std::mutex lock;
+
+      return transfer(items,
+                      [&](uint64_t value)
+                      {
+                        std::lock_guard<std::mutex> guard(lock);
+
+                        if (queue.full())
+                        {
+                          return false;
+                        }
+
+                        queue.push(value);
+                        return true;
+                      },
+                      [&](uint64_t& value)
+                      {
+                        std::lock_guard<std::mutex> guard(lock);
+
+                        if (queue.empty())
+                        {
+                          return false;
+                        }
+
+                        value = queue.front();
+                        queue.pop();
+                        return true;
+                      });
+    });
+
+    measure("queue_spsc", [](uint64_t items)
+    {
+      etl::queue_spsc<uint64_t, QUEUE_SIZE> queue;
+
+      return transfer(items,
+                      [&](uint64_t value) { return queue.push(value); },
+                      [&](uint64_t& value) { return queue.pop(value); });
+    });
+  }
+
+  //***************************************************************************
+  // Passes 'items' values from 'threads' producer threads to 'threads'
+  // consumer threads. Each producer pushes an equal share.
+  // 'push(first, last)' returns the number of values pushed from the range,
+  // and 'pop(values, n)' the number popped, up to 'n'.
+  // Returns the sum of the values popped.
+  //***************************************************************************
+  template <typename TPush, typename TPop>
+  uint64_t contend(uint64_t items, size_t threads, size_t batch, TPush push, TPop pop)
+  {
+    const uint64_t share = items / threads;
+
+    std::vector<std::thread> workers;
+    std::vector<uint64_t>    sums(threads, 0);
+    std::atomic<uint64_t>    remaining(share * threads);
+
+    for (size_t t = 0; t < threads; ++t)
+    {
+      workers.push_back(std::thread([share, batch, &push]()
+      {
+        uint64_t values[BATCH_SIZE];
+        uint64_t i = 0;
+
+        while (i < share)
+        {
+          size_t n = 0;
+
+          while ((n < batch) && ((i + n) < share))
+          {
+            values[n] = i + n;
+            ++n;
+          }
+
+          backoff wait;
+          size_t  pushed = 0;
+
+          while (pushed < n)
+          {
+            size_t count = push(values + pushed, values + n);
+
+            if (count == 0)
+            {
+              wait();
+            }
+
+            pushed += count;
+          }
+
+          i += n;
+        }
+      }));
+
+      workers.push_back(std::thread([t, batch, &pop, &sums, &remaining]()
+      {
+        uint64_t values[BATCH_SIZE];
+        uint64_t sum = 0;
+        backoff  wait;
+
+        while (remaining.load(std::memory_order_relaxed) != 0)
+        {
+          size_t count = pop(values, batch);
+
+          if (count == 0)
+          {
+            wait();
+            continue;
+          }
+
+          remaining.fetch_sub(count, std::memory_order_relaxed);
+
+          for (size_t i = 0; i < count; ++i)
+          {
+            sum += values[i];
+          }
+        }
+
+        sums[t] = sum;
+      }));
+    }
+
+    uint64_t sum = 0;
+
+    for (size_t t = 0; t < workers.size(); ++t)
+    {
+      workers[t].join();
+    }
+
+    for (size_t t = 0; t < threads; ++t)
+    {
+      sum += sums[t];
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  // The multi producer, multi consumer queues.
+  //***************************************************************************
+  void mpmc_benchmarks()
+  {
+    const size_t PRODUCERS[] = { 1, 2, 4, 8, 16 };
+
+    for (size_t i = 0; i < sizeof(PRODUCERS) / sizeof(PRODUCERS[0]); ++i)
+    {
+      const size_t threads = PRODUCERS[i];
+      const std::string suffix = "/threads:" + std::to_string(2 * threads);
+
+      measure("queue+mutex/mpmc" + suffix, [threads](uint64_t items)
+      {
+        etl::queue<uint64_t, QUEUE_SIZE> queue;
+        std::mutex lock;
+
+        return contend(items, threads, 1,
+                       [&](const uint64_t* first, const uint64_t* last)
+                       {
+                         std::lock_guard<std::mutex> guard(lock);
+
+                         size_t count = 0;
+
+                         while ((first != last) && !queue.full())
+                         {
+                           queue.push(*first++);
+                           ++count;
+                         }
+
+                         return count;
+                       },
+                       [&](uint64_t* values, size_t n)
+                       {
+                         std::lock_guard<std::mutex> guard(lock);
+
+                         size_t count = 0;
+
+                         while ((count < n) && !queue.empty())
+                         {
+                           values[count++] = queue.front();
+                           queue.pop();
+                         }
+
+                         return count;
+                       });
+      });
+
+      measure("queue_mpmc" + suffix, [threads](uint64_t items)
+      {
+        etl::queue_mpmc<uint64_t, QUEUE_SIZE> queue;
+
+        return contend(items, threads, 1,
+                       [&](const uint64_t* first, const uint64_t*)
+                       {
+                         return queue.try_push(*first) ? size_t(1) : size_t(0);
+                       },
+                       [&](uint64_t* values, size_t)
+                       {
+                         return queue.try_pop(*values) ? size_t(1) : size_t(0);
+                       });
+      });
+
+      measure("queue_mpmc/batch:16" + suffix, [threads](uint64_t items)
+      {
+        etl::queue_mpmc<uint64_t, QUEUE_SIZE> queue;
+
+        return contend(items, threads, BATCH_SIZE,
+                       [&](const uint64_t* first, const uint64_t* last)
+                       {
+                         return queue.try_push(first, last);
+                       },
+                       [&](uint64_t* values, size_t n)
+                       {
+                         return queue.try_pop(values, n);
+                       });
+      });
+    }
+  }
+
+  //***************************************************************************
+  // Writes the run context.
+  //***************************************************************************
+  void write_context(const char* executable)
+  {
+    char date[64];
+    time_t now = time(0);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    printf("{\n");
+    printf("  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"executable\": \"%s\",\n", executable);
+    printf("    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    printf("    \"library\": \"etl\",\n");
+    printf("    \"min_time\": %g\n", settings.min_time);
+    printf("  },\n");
+    printf("  \"benchmarks\": [\n");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+    {
+      settings.filter = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--min_time") == 0) && ((i + 1) < argc))
+    {
+      settings.min_time = atof(argv[++i]);
+    }
+    else
+    {
+      fprintf(stderr, "usage: benchmark_queue [--filter text] [--min_time seconds]\n");
+      return 2;
+    }
+  }
+
+  write_context(argv[0]);
+
+  spsc_benchmarks();
+  mpmc_benchmarks();
+
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
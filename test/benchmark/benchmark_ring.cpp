@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks for the ring buffer index arithmetic of the deque.
+// Indexing is run through a reference to the base class, which steps an
+// iterator that wraps with the size stored in the object, and on the derived
+// class, which wraps with the compile time size. The deques are 63 items
+// (a buffer of 64, a power of two) and 64 items, as their buffers hold one more.
+// The results are written to stdout as JSON, in the layout used by Google
+// Benchmark.
+//
+// usage: benchmark_ring [--filter text] [--min_time seconds]
+//
+// Build, for example, with:
+//   g++ -std=c++11 -O2 -DCOMPILER_GCC -DPLATFORM_LINUX -DETL_THROW_EXCEPTIONS -I../.. benchmark_ring.cpp -o benchmark_ring
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "../../deque.h"
+
+#if defined(COMPILER_MICROSOFT)
+  #define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+  #define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace
+{
+  //***************************************************************************
+  // Options and shared state.
+  //***************************************************************************
+  struct options
+  {
+    std::string filter;
+    double      min_time = 0.2;
+  };
+
+  options settings;
+  bool    first_result = true;
+
+  // Stops the compiler discarding the results.
+  volatile uint64_t sink;
+
+  //***************************************************************************
+  // Writes one result.
+  //***************************************************************************
+  void report(const std::string& name, uint64_t items, double seconds)
+  {
+    const double ns_per_item = (seconds * 1e9) / double(items);
+
+    printf("%s    {\n", first_result ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", name.c_str());
+    printf("      \"iterations\": %llu,\n", static_cast<unsigned long long>(items));
+    printf("      \"real_time\": %.3f,\n", ns_per_item);
+    printf("      \"time_unit\": \"ns\",\n");
+    printf("      \"items_per_second\": %.0f\n", double(items) / seconds);
+    printf("    }");
+
+    fflush(stdout);
+    fprintf(stderr, "%-40s %12.3f ns %10.1f M/s\n", name.c_str(), ns_per_item, double(items) / (seconds * 1e6));
+
+    first_result = false;
+  }
+
+  bool selected(const std::string& name)
+  {
+    return settings.filter.empty() || (name.find(settings.filter) != std::string::npos);
+  }
+
+  //***************************************************************************
+  // Runs 'function(items)' for increasing numbers of items until the run
+  // takes at least the minimum time.
+  //***************************************************************************
+  template <typename TFunction>
+  void measure(const std::string& name, TFunction function)
+  {
+    if (!selected(name))
+    {
+      return;
+    }
+
+    uint64_t items = 1024;
+
+    for (;;)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      sink = sink + function(items);
+
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      if ((seconds >= settings.min_time) || (items >= (uint64_t(1) << 40)))
+      {
+        report(name, items, seconds);
+        return;
+      }
+
+      // Aim a little past the minimum time on the next pass.
+      double scale = (seconds > 0.0) ? (1.4 * settings.min_time) / seconds : 100.0;
+
+      if (scale > 100.0)
+      {
+        scale = 100.0;
+      }
+
+      uint64_t next = uint64_t(double(items) * scale);
+      items = (next > items) ? next : items + 1;
+    }
+  }
+
+  //***************************************************************************
+  // Reads 'items' values from a full deque by index, rotating the deque
+  // after each pass so that the reads wrap around the buffer.
+  // Not inlined, so that the base class cannot see the size of the object.
+  //***************************************************************************
+  template <typename TDeque>
+  BENCHMARK_NOINLINE uint64_t index(TDeque& deque, uint64_t items)
+  {
+    uint64_t sum = 0;
+
+    while (!deque.full())
+    {
+      deque.push_back(uint32_t(deque.size()));
+    }
+
+    const size_t size = deque.size();
+
+    for (uint64_t i = 0; i < items; i += size)
+    {
+      for (size_t j = 0; j < size; ++j)
+      {
+        sum += deque[j];
+      }
+
+      const uint32_t value = deque.front();
+      deque.pop_front();
+      deque.push_back(value);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  // The deques.
+  //***************************************************************************
+  void deque_benchmarks()
+  {
+    measure("deque/index/ideque/size:63", [](uint64_t items)
+    {
+      etl::deque<uint32_t, 63> deque;
+      return index(static_cast<etl::ideque<uint32_t>&>(deque), items);
+    });
+
+    measure("deque/index/size:63", [](uint64_t items)
+    {
+      etl::deque<uint32_t, 63> deque;
+      return index(deque, items);
+    });
+
+    measure("deque/index/ideque/size:64", [](uint64_t items)
+    {
+      etl::deque<uint32_t, 64> deque;
+      return index(static_cast<etl::ideque<uint32_t>&>(deque), items);
+    });
+
+    measure("deque/index/size:64", [](uint64_t items)
+    {
+      etl::deque<uint32_t, 64> deque;
+      return index(deque, items);
+    });
+  }
+
+  //***************************************************************************
+  // Writes the run context.
+  //***************************************************************************
+  void write_context(const char* executable)
+  {
+    char date[64];
+    time_t now = time(0);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    printf("{\n");
+    printf("  \"context\": {\n");
+    printf("    \"date\": \"%s\",\n", date);
+    printf("    \"executable\": \"%s\",\n", executable);
+    printf("    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    printf("    \"library\": \"etl\",\n");
+    printf("    \"min_time\": %g\n", settings.min_time);
+    printf("  },\n");
+    printf("  \"benchmarks\": [\n");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "--filter") == 0) && ((i + 1) < argc))
+    {
+      settings.filter = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--min_time") == 0) && ((i + 1) < argc))
+    {
+      settings.min_time = atof(argv[++i]);
+    }
+    else
+    {
+      fprintf(stderr, "usage: benchmark_ring [--filter text] [--min_time seconds]\n");
+      return 2;
+    }
+  }
+
+  write_context(argv[0]);
+
+  deque_benchmarks();
+
+  printf("\n  ]\n}\n");
+
+  return 0;
+}
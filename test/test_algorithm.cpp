@@ -33,6 +33,7 @@ SOFTWARE.
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <string>
 
 namespace
 {
@@ -310,5 +311,31 @@ namespace
       int* p = std::find_if_not(std::begin(data1), std::end(data1), std::bind2nd(std::less<int>(), 4));
       CHECK_EQUAL(5, *p);
     }
+
+    //=========================================================================
+    TEST(move)
+    {
+      std::vector<std::string> source = { "one", "two", "three" };
+      std::vector<std::string> destination(3);
+
+      std::vector<std::string>::iterator end = etl::move(source.begin(), source.end(), destination.begin());
+
+      CHECK(end == destination.end());
+      CHECK_EQUAL(std::string("one"),   destination[0]);
+      CHECK_EQUAL(std::string("two"),   destination[1]);
+      CHECK_EQUAL(std::string("three"), destination[2]);
+    }
+
+    //=========================================================================
+    TEST(move_backward)
+    {
+      std::vector<std::string> data = { "one", "two", "three", "" };
+
+      etl::move_backward(data.begin(), data.begin() + 3, data.end());
+
+      CHECK_EQUAL(std::string("one"),   data[1]);
+      CHECK_EQUAL(std::string("two"),   data[2]);
+      CHECK_EQUAL(std::string("three"), data[3]);
+    }
   };
 }
@@ -161,5 +161,36 @@ namespace
       CHECK((size_t(&data_data[0].value) % expected) == 0);
       CHECK((size_t(&data_data[1].value) % expected) == 0);
     }
+
+    //*************************************************************************
+    TEST(test_aligned_storage)
+    {
+      typedef etl::aligned_storage<sizeof(Data) * 3, etl::alignment_of<Data>::value>::type storage_data;
+      CHECK(sizeof(storage_data) >= (sizeof(Data) * 3));
+      CHECK_EQUAL(size_t(std::alignment_of<Data>::value), size_t(etl::alignment_of<storage_data>::value));
+
+      typedef etl::aligned_storage<5, 8>::type storage_8;
+      CHECK(sizeof(storage_8) >= 5);
+      CHECK_EQUAL(8U, size_t(etl::alignment_of<storage_8>::value));
+
+      storage_8 buffer[2];
+      CHECK((size_t(&buffer[0]) % 8) == 0);
+      CHECK((size_t(&buffer[1]) % 8) == 0);
+    }
+    //*************************************************************************
+    TEST(test_aligned_storage_over_aligned)
+    {
+      struct alignas(32) Over_Aligned
+      {
+        float f[8];
+      };
+
+      typedef etl::aligned_storage<sizeof(Over_Aligned) * 2, etl::alignment_of<Over_Aligned>::value>::type storage_32;
+      CHECK_EQUAL(32U, size_t(etl::alignment_of<storage_32>::value));
+
+      storage_32 buffer[2];
+      CHECK((size_t(&buffer[0]) % 32) == 0);
+      CHECK((size_t(&buffer[1]) % 32) == 0);
+    }
   };
 }
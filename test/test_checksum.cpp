@@ -26,16 +26,94 @@ SOFTWARE.
 
 #include <UnitTest++/UnitTest++.h>
 
+#include <algorithm>
 #include <iterator>
 #include <string>
 #include <vector>
 #include <stdint.h>
 
 #include "../checksum.h"
+#include "../internet_checksum.h"
+#include "../fletcher16.h"
+#include "../fletcher32.h"
+#include "../adler32.h"
 #include "../endian.h"
 
 namespace
-{		
+{
+  //***************************************************************************
+  // Byte at a time reference implementations.
+  //***************************************************************************
+  uint16_t reference_internet(const std::vector<uint8_t>& data)
+  {
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      sum += ((i % 2) == 0) ? (uint32_t(data[i]) << 8) : data[i];
+      sum  = (sum & 0xFFFF) + (sum >> 16);
+    }
+
+    return uint16_t(~sum);
+  }
+
+  uint32_t reference_fletcher(const std::vector<uint8_t>& data, bool words, uint32_t modulus, uint32_t initial, int shift)
+  {
+    uint32_t sum1 = initial;
+    uint32_t sum2 = 0;
+
+    for (size_t i = 0; i < data.size(); i += (words ? 2 : 1))
+    {
+      uint32_t value = data[i];
+
+      if (words && ((i + 1) < data.size()))
+      {
+        value |= uint32_t(data[i + 1]) << 8;
+      }
+
+      sum1 = (sum1 + value) % modulus;
+      sum2 = (sum2 + sum1) % modulus;
+    }
+
+    return (sum2 << shift) | sum1;
+  }
+
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data;
+
+    // Mostly high values, to push the deferred sums towards overflow.
+    for (size_t i = 0; i < size; ++i)
+    {
+      data.push_back(uint8_t(0xFF - ((i * 7) % 13)));
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  // Checks a checksum over a large buffer, added whole and in odd sized pieces.
+  //***************************************************************************
+  template <typename TChecksum>
+  bool check_pieces(const std::vector<uint8_t>& data, typename TChecksum::value_type expected)
+  {
+    TChecksum whole(data.data(), data.data() + data.size());
+
+    TChecksum pieces;
+    size_t    i    = 0;
+    size_t    size = 1;
+
+    while (i < data.size())
+    {
+      size_t length = std::min(size, data.size() - i);
+      pieces.add(data.data() + i, data.data() + i + length);
+      i    += length;
+      size  = (size * 3) + 1;
+    }
+
+    return (whole.value() == expected) && (pieces.value() == expected);
+  }
+
   SUITE(test_checksum)
   {
     //*************************************************************************
@@ -107,6 +185,131 @@ namespace
       uint8_t sum3 = etl::checksum<uint8_t, etl::endian::big>(data3.begin(), data3.end());
       CHECK_EQUAL(int(sum1), int(sum3));
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_words)
+    {
+      std::vector<uint8_t>  data1 = { 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0x09, 0x0A };
+      std::vector<uint64_t> data2 = { 0xF8F7F6F5F4F3F2F1 };
+      std::vector<uint16_t> data3 = { 0x0A09 };
+
+      uint32_t sum1 = etl::checksum<uint32_t>(data1.begin(), data1.end());
+
+      etl::checksum<uint32_t> checksum_calculator;
+      checksum_calculator.add(data2[0]);
+      checksum_calculator.add(int16_t(data3[0]));
+      CHECK_EQUAL(sum1, checksum_calculator.value());
+
+      // Contiguous ranges of words.
+      checksum_calculator.reset();
+      checksum_calculator.add(data2.data(), data2.data() + data2.size());
+      checksum_calculator.add(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(sum1, checksum_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_add_range_volatile)
+    {
+      const uint16_t          data1[] = { 0x0201, 0x0403, 0x0605 };
+      volatile const uint16_t data2[] = { 0x0201, 0x0403, 0x0605 };
+
+      CHECK_EQUAL(etl::checksum<uint32_t>(data1, data1 + 3).value(),   etl::checksum<uint32_t>(data2, data2 + 3).value());
+      CHECK_EQUAL(etl::internet_checksum<>(data1, data1 + 3).value(),  etl::internet_checksum<>(data2, data2 + 3).value());
+      CHECK_EQUAL(etl::fletcher16<>(data1, data1 + 3).value(),         etl::fletcher16<>(data2, data2 + 3).value());
+      CHECK_EQUAL(etl::fletcher32<>(data1, data1 + 3).value(),         etl::fletcher32<>(data2, data2 + 3).value());
+      CHECK_EQUAL(etl::adler32<>(data1, data1 + 3).value(),            etl::adler32<>(data2, data2 + 3).value());
+    }
+
+    //*************************************************************************
+    TEST(test_internet_checksum)
+    {
+      // The example from RFC 1071.
+      std::vector<uint8_t> data = { 0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7 };
+
+      CHECK_EQUAL(0x220D, etl::internet_checksum<>(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x220D, etl::internet_checksum<>(data.data(), data.data() + data.size()).value());
+
+      std::string text("123456789");
+      CHECK_EQUAL(0xF62A, etl::internet_checksum<>(text.begin(), text.end()).value());
+      CHECK_EQUAL(0xF62A, etl::internet_checksum<>(text.c_str(), text.c_str() + text.size()).value());
+
+      // Words are added in network order by default.
+      std::vector<uint16_t> words = { 0x0001, 0xF203, 0xF4F5, 0xF6F7 };
+      CHECK_EQUAL(0x220D, etl::internet_checksum<>(words.begin(), words.end()).value());
+      CHECK_EQUAL(0x220D, etl::internet_checksum<>(words.data(), words.data() + words.size()).value());
+
+      // A packet including its checksum sums to zero.
+      data.push_back(0x22);
+      data.push_back(0x0D);
+      CHECK_EQUAL(0x0000, etl::internet_checksum<>(data.data(), data.data() + data.size()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher16)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8F0, etl::fletcher16<>(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x2057, etl::fletcher16<>(data2.begin(), data2.end()).value());
+      CHECK_EQUAL(0x0627, etl::fletcher16<>(data3.c_str(), data3.c_str() + data3.size()).value());
+
+      etl::fletcher16<> fletcher16_calculator;
+
+      for (size_t i = 0; i < data3.size(); ++i)
+      {
+        fletcher16_calculator += data3[i];
+      }
+
+      CHECK_EQUAL(0x0627, uint16_t(fletcher16_calculator));
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher32)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xF04FC729, etl::fletcher32<>(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x56502D2A, etl::fletcher32<>(data2.begin(), data2.end()).value());
+      CHECK_EQUAL(0xEBE19591, etl::fletcher32<>(data3.c_str(), data3.c_str() + data3.size()).value());
+      CHECK_EQUAL(0xF04FC729, etl::fletcher32<>(data1.c_str(), data1.c_str() + data1.size()).value());
+
+      // Words are little endian by default.
+      std::vector<uint16_t> words = { 0x6261, 0x6463, 0x6665 };
+      CHECK_EQUAL(0x56502D2A, etl::fletcher32<>(words.begin(), words.end()).value());
+      CHECK_EQUAL(0x56502D2A, etl::fletcher32<>(words.data(), words.data() + words.size()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32)
+    {
+      std::string data1("Wikipedia");
+      std::string data2("123456789");
+
+      CHECK_EQUAL(0x11E60398, etl::adler32<>(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x091E01DE, etl::adler32<>(data2.c_str(), data2.c_str() + data2.size()).value());
+      CHECK_EQUAL(0x00000001, etl::adler32<>().value());
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_engines_large)
+    {
+      // Larger than the reduction blocks, and not a multiple of the vector width.
+      std::vector<uint8_t> data = make_data(100003);
+
+      CHECK(check_pieces<etl::internet_checksum<> >(data, reference_internet(data)));
+      CHECK(check_pieces<etl::fletcher16<> >(data, uint16_t(reference_fletcher(data, false, 255, 0, 8))));
+      CHECK(check_pieces<etl::fletcher32<> >(data, reference_fletcher(data, true, 65535, 0, 16)));
+      CHECK(check_pieces<etl::adler32<> >(data, reference_fletcher(data, false, 65521, 1, 16)));
+
+      data.pop_back();
+
+      CHECK(check_pieces<etl::internet_checksum<> >(data, reference_internet(data)));
+      CHECK(check_pieces<etl::fletcher32<> >(data, reference_fletcher(data, true, 65535, 0, 16)));
+    }
   };
 }
 
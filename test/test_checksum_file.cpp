@@ -0,0 +1,143 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../checksum_file.h"
+#include "../crc32.h"
+#include "../crc64_ecma.h"
+#include "../fnv_1.h"
+#include "../checksum.h"
+
+namespace
+{
+  const char* const FILE_NAME = "etl_test_checksum_file.bin";
+
+  //***************************************************************************
+  // Writes the data to the test file.
+  //***************************************************************************
+  void write_file(const std::vector<uint8_t>& data)
+  {
+    FILE* file = fopen(FILE_NAME, "wb");
+
+    if (!data.empty())
+    {
+      fwrite(&data[0], 1, data.size(), file);
+    }
+
+    fclose(file);
+  }
+
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      data.push_back(uint8_t((i * 31) ^ (i >> 8)));
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  // Checks that both file paths agree with hashing the data in memory.
+  //***************************************************************************
+  template <typename THash>
+  bool check_file(const std::vector<uint8_t>& data)
+  {
+    THash expected;
+    expected.add(data.begin(), data.end());
+
+    uint8_t buffer[4099];
+
+    etl::checksum_file_result<THash> whole = etl::checksum_file<THash>(FILE_NAME);
+    etl::checksum_file_result<THash> read  = etl::checksum_file<THash>(FILE_NAME, buffer, sizeof(buffer));
+
+    return (whole.value == expected.value()) && (whole.bytes == data.size()) &&
+           (read.value  == expected.value()) && (read.bytes  == data.size()) && !read.mapped;
+  }
+
+  SUITE(test_checksum_file)
+  {
+    //*************************************************************************
+    TEST(test_checksum_file_check_value)
+    {
+      std::string text("123456789");
+      write_file(std::vector<uint8_t>(text.begin(), text.end()));
+
+      etl::checksum_file_result<etl::crc32<> > result = etl::checksum_file<etl::crc32<> >(FILE_NAME);
+
+      CHECK_EQUAL(0xCBF43926, result.value);
+      CHECK_EQUAL(9U, result.bytes);
+      CHECK(result.seconds >= 0.0);
+      CHECK(result.bytes_per_second() >= 0.0);
+
+      remove(FILE_NAME);
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_file_empty)
+    {
+      write_file(std::vector<uint8_t>());
+
+      etl::checksum_file_result<etl::crc32<> > result = etl::checksum_file<etl::crc32<> >(FILE_NAME);
+
+      CHECK_EQUAL(etl::crc32<>().value(), result.value);
+      CHECK_EQUAL(0U, result.bytes);
+      CHECK(!result.mapped);
+
+      remove(FILE_NAME);
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_file_engines)
+    {
+      std::vector<uint8_t> data = make_data(300000);
+      write_file(data);
+
+      CHECK(check_file<etl::crc32<> >(data));
+      CHECK(check_file<etl::crc64_ecma<> >(data));
+      CHECK(check_file<etl::fnv_1a_64<> >(data));
+      CHECK(check_file<etl::checksum<uint32_t> >(data));
+
+      remove(FILE_NAME);
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_file_missing)
+    {
+      remove(FILE_NAME);
+
+      CHECK_THROW(etl::checksum_file<etl::crc32<> >(FILE_NAME), etl::checksum_file_open_error);
+    }
+  };
+}
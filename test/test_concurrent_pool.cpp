@@ -0,0 +1,285 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "../concurrent_pool.h"
+
+namespace
+{
+  struct Message
+  {
+    Message(size_t owner, size_t sequence)
+      : owner(owner),
+        sequence(sequence)
+    {
+    }
+
+    size_t owner;
+    size_t sequence;
+  };
+
+  // Throws from its constructor when asked to.
+  struct Throwing
+  {
+    Throwing(bool do_throw)
+    {
+      if (do_throw)
+      {
+        throw 0;
+      }
+    }
+  };
+
+  const size_t N_THREADS    = 4;
+  const size_t N_ITERATIONS = 50000;
+  const size_t N_HELD       = 8;
+  const size_t POOL_SIZE    = N_THREADS * (N_HELD + 4);
+
+  typedef etl::concurrent_pool<Message, POOL_SIZE> Pool;
+
+  //***************************************************************************
+  // Each thread repeatedly creates a few messages, checks that no other
+  // thread has written to them, then destroys them.
+  // Returns the number of corrupted messages seen.
+  //***************************************************************************
+  template <typename TAllocator>
+  size_t exercise(TAllocator& allocator, size_t owner)
+  {
+    size_t errors = 0;
+    Message* held[N_HELD];
+
+    for (size_t i = 0; i < N_ITERATIONS; ++i)
+    {
+      const size_t n = (i % N_HELD) + 1;
+
+      for (size_t j = 0; j < n; ++j)
+      {
+        held[j] = allocator.create(owner, i + j);
+      }
+
+      std::this_thread::yield();
+
+      for (size_t j = 0; j < n; ++j)
+      {
+        if ((held[j]->owner != owner) || (held[j]->sequence != (i + j)))
+        {
+          ++errors;
+        }
+
+        allocator.destroy(held[j]);
+      }
+    }
+
+    return errors;
+  }
+
+  //***************************************************************************
+  template <typename TWorker>
+  size_t run_threads(TWorker worker)
+  {
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < N_THREADS; ++t)
+    {
+      threads.push_back(std::thread([&errors, &worker, t]() { errors += worker(t); }));
+    }
+
+    for (size_t t = 0; t < N_THREADS; ++t)
+    {
+      threads[t].join();
+    }
+
+    return errors;
+  }
+
+  SUITE(test_concurrent_pool)
+  {
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::concurrent_pool<Message, 4> pool;
+
+      CHECK_EQUAL(4U, pool.available());
+      CHECK_EQUAL(4U, pool.max_size());
+
+      std::vector<Message*> allocated;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        allocated.push_back(pool.allocate());
+        CHECK(pool.is_in_pool(allocated.back()));
+      }
+
+      CHECK(pool.empty());
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      std::sort(allocated.begin(), allocated.end());
+      CHECK(std::adjacent_find(allocated.begin(), allocated.end()) == allocated.end());
+
+      pool.release(allocated[2]);
+      CHECK_EQUAL(1U, pool.available());
+      CHECK(pool.allocate() == allocated[2]);
+
+      Message not_in_pool(0, 0);
+      CHECK(!pool.is_in_pool(not_in_pool));
+      CHECK_THROW(pool.release(not_in_pool), etl::pool_object_not_in_pool);
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        pool.release(*allocated[i]);
+      }
+
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::concurrent_pool<Message, 2> pool;
+
+      Message* p1 = pool.create(1, 10);
+      Message* p2 = pool.create(2, 20);
+
+      CHECK_EQUAL(1U,  p1->owner);
+      CHECK_EQUAL(10U, p1->sequence);
+      CHECK_EQUAL(2U,  p2->owner);
+      CHECK_EQUAL(20U, p2->sequence);
+
+      CHECK_THROW(pool.create(3, 30), etl::pool_no_allocation);
+
+      pool.destroy(p1);
+      pool.destroy(p2);
+
+      CHECK_EQUAL(2U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_create_throwing_constructor)
+    {
+      typedef etl::concurrent_pool<Throwing, 4> Throwing_Pool;
+
+      Throwing_Pool pool;
+
+      CHECK_THROW(pool.create(true), int);
+      CHECK_EQUAL(4U, pool.available());
+
+      {
+        Throwing_Pool::cache<2> cache(pool);
+
+        CHECK_THROW(cache.create(true), int);
+
+        // The item is given back to the cache.
+        CHECK_EQUAL(1U, cache.size());
+      }
+
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_cache)
+    {
+      Pool pool;
+
+      {
+        Pool::cache<4> cache(pool);
+
+        Message* p1 = cache.create(1, 1);
+
+        // Half a cache is taken from the pool.
+        CHECK_EQUAL(1U, cache.size());
+        CHECK_EQUAL(POOL_SIZE - 2, pool.available());
+
+        cache.destroy(p1);
+        CHECK_EQUAL(2U, cache.size());
+
+        std::vector<Message*> allocated;
+
+        for (size_t i = 0; i < POOL_SIZE; ++i)
+        {
+          allocated.push_back(cache.allocate());
+        }
+
+        CHECK_EQUAL(0U, cache.size());
+        CHECK(pool.empty());
+        CHECK_THROW(cache.allocate(), etl::pool_no_allocation);
+
+        // Overflowing the cache returns half of it to the pool.
+        for (size_t i = 0; i < 5; ++i)
+        {
+          cache.release(allocated[i]);
+        }
+
+        CHECK_EQUAL(3U, cache.size());
+        CHECK_EQUAL(2U, pool.available());
+
+        Message not_in_pool(0, 0);
+        CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+
+        for (size_t i = 5; i < POOL_SIZE; ++i)
+        {
+          cache.release(allocated[i]);
+        }
+      }
+
+      // The cache returns its items when it is destroyed.
+      CHECK_EQUAL(POOL_SIZE, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_stress)
+    {
+      Pool pool;
+
+      const size_t errors = run_threads([&pool](size_t owner) { return exercise(pool, owner); });
+
+      CHECK_EQUAL(0U, errors);
+      CHECK_EQUAL(POOL_SIZE, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_stress_with_caches)
+    {
+      Pool pool;
+
+      const size_t errors = run_threads([&pool](size_t owner)
+      {
+        // Small enough that caches must exchange items through the pool.
+        Pool::cache<4> cache(pool);
+        return exercise(cache, owner);
+      });
+
+      CHECK_EQUAL(0U, errors);
+      CHECK_EQUAL(POOL_SIZE, pool.available());
+    }
+  };
+}
@@ -31,11 +31,14 @@ SOFTWARE.
 #include <vector>
 #include <stdint.h>
 
+#include "../crc.h"
+#include "../crc_hardware.h"
 #include "../crc8_ccitt.h"
 #include "../crc16.h"
 #include "../crc16_ccitt.h"
 #include "../crc16_kermit.h"
 #include "../crc32.h"
+#include "../crc32_c.h"
 #include "../crc64_ecma.h"
 #include "../endian.h"
 
@@ -99,6 +102,19 @@ namespace
       CHECK_EQUAL(int(crc1), int(crc3));
     }
 
+    //*************************************************************************
+    TEST(test_crc8_ccitt_combine)
+    {
+      std::string data("123456789");
+
+      uint8_t crc_a = etl::crc8_ccitt<>(data.begin(), data.begin() + 4);
+      uint8_t crc_b = etl::crc8_ccitt<>(data.begin() + 4, data.end());
+
+      uint8_t crc = etl::crc8_ccitt<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0xF4, int(crc));
+    }
+
     //*************************************************************************
     TEST(test_crc16)
     {
@@ -155,6 +171,19 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_combine)
+    {
+      std::string data("123456789");
+
+      uint16_t crc_a = etl::crc16<>(data.begin(), data.begin() + 4);
+      uint16_t crc_b = etl::crc16<>(data.begin() + 4, data.end());
+
+      uint16_t crc = etl::crc16<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0xBB3D, crc);
+    }
+
     //*************************************************************************
     TEST(test_crc16_ccitt)
     {
@@ -211,6 +240,40 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_ccitt_combine)
+    {
+      std::string data("123456789");
+
+      uint16_t crc_a = etl::crc16_ccitt<>(data.begin(), data.begin() + 4);
+      uint16_t crc_b = etl::crc16_ccitt<>(data.begin() + 4, data.end());
+
+      uint16_t crc = etl::crc16_ccitt<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0x29B1, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_ccitt_combine_all_splits)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.push_back(uint8_t(i * 13 + 5));
+      }
+
+      uint16_t crc = etl::crc16_ccitt<>(data.begin(), data.end());
+
+      for (size_t split = 0; split <= data.size(); ++split)
+      {
+        uint16_t crc_a = etl::crc16_ccitt<>(data.begin(), data.begin() + split);
+        uint16_t crc_b = etl::crc16_ccitt<>(data.begin() + split, data.end());
+
+        CHECK_EQUAL(crc, etl::crc16_ccitt<>::combine(crc_a, crc_b, data.size() - split));
+      }
+    }
+
     //*************************************************************************
     TEST(test_crc16_kermit)
     {
@@ -267,6 +330,19 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_kermit_combine)
+    {
+      std::string data("123456789");
+
+      uint16_t crc_a = etl::crc16_kermit<>(data.begin(), data.begin() + 4);
+      uint16_t crc_b = etl::crc16_kermit<>(data.begin() + 4, data.end());
+
+      uint16_t crc = etl::crc16_kermit<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0x2189, crc);
+    }
+
     //*************************************************************************
     TEST(test_crc32)
     {
@@ -323,6 +399,374 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc32_combine)
+    {
+      std::string data("123456789");
+
+      uint32_t crc_a = etl::crc32<>(data.begin(), data.begin() + 4);
+      uint32_t crc_b = etl::crc32<>(data.begin() + 4, data.end());
+
+      uint32_t crc = etl::crc32<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0xCBF43926, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_combine_all_splits)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.push_back(uint8_t(i * 13 + 5));
+      }
+
+      uint32_t crc = etl::crc32<>(data.begin(), data.end());
+
+      for (size_t split = 0; split <= data.size(); ++split)
+      {
+        uint32_t crc_a = etl::crc32<>(data.begin(), data.begin() + split);
+        uint32_t crc_b = etl::crc32<>(data.begin() + split, data.end());
+
+        CHECK_EQUAL(crc, etl::crc32<>::combine(crc_a, crc_b, data.size() - split));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32<etl::endian::little, etl::crc_slice_by_8>(data.c_str(), data.c_str() + data.size());
+
+      CHECK_EQUAL(0xCBF43926, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8_matches_slice_by_1)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(uint8_t(i * 7 + (i >> 3)));
+      }
+
+      // Check every length, so that all of the trailing byte counts are covered.
+      for (size_t length = 0; length < data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* end   = begin + length;
+
+        uint32_t crc1 = etl::crc32<etl::endian::little, etl::crc_slice_by_1>(begin, end);
+        uint32_t crc2 = etl::crc32<etl::endian::little, etl::crc_slice_by_8>(begin, end);
+        uint32_t crc3 = etl::crc32<>(data.begin(), data.begin() + length);
+
+        CHECK_EQUAL(crc1, crc2);
+        CHECK_EQUAL(crc1, crc3);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8_add_in_parts)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      etl::crc32<etl::endian::little, etl::crc_slice_by_8> crc_calculator;
+
+      crc_calculator.add(data.c_str(), data.c_str() + 5);
+      crc_calculator.add(data[5]);
+      crc_calculator.add(data.c_str() + 6, data.c_str() + data.size());
+
+      CHECK_EQUAL(0x414FA339, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c<>(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c<> crc_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        crc_calculator += data[i];
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c<> crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint32_t> data3 = { 0x01020304, 0x05060708 };
+
+      uint32_t crc1 = etl::crc32_c<etl::endian::little>(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32_c<etl::endian::little>(data2.begin(), data2.end());
+      CHECK_EQUAL(crc1, crc2);
+
+      uint32_t crc3 = etl::crc32_c<etl::endian::big>(data3.begin(), data3.end());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_combine)
+    {
+      std::string data("123456789");
+
+      uint32_t crc_a = etl::crc32_c<>(data.begin(), data.begin() + 4);
+      uint32_t crc_b = etl::crc32_c<>(data.begin() + 4, data.end());
+
+      uint32_t crc = etl::crc32_c<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_contiguous_range)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      uint32_t crc1 = etl::crc32_c<>(data.c_str(), data.c_str() + data.size());
+      CHECK_EQUAL(0x22620404, crc1);
+
+      uint32_t crc2 = etl::crc32_c<>(data.begin(), data.end());
+      CHECK_EQUAL(crc1, crc2);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_generic_check_values)
+    {
+      std::string data("123456789");
+
+      // CRC-32/BZIP2
+      CHECK_EQUAL(0xFC891918U, uint32_t(etl::crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>(data.begin(), data.end())));
+
+      // CRC-16/XMODEM
+      CHECK_EQUAL(0x31C3, uint16_t(etl::crc<16, 0x1021, 0x0000, false, false, 0x0000>(data.begin(), data.end())));
+
+      // CRC-64/XZ
+      CHECK_EQUAL(0x995DC9BBDF1939FAULL, uint64_t(etl::crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF>(data.begin(), data.end())));
+
+      // CRC-24/OPENPGP
+      CHECK_EQUAL(0x21CF02U, uint32_t(etl::crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>(data.begin(), data.end())));
+
+      // CRC-12/3GPP (reflected output only)
+      CHECK_EQUAL(0xDAF, uint16_t(etl::crc<12, 0x80F, 0x000, false, true, 0x000>(data.begin(), data.end())));
+
+      // CRC-10/ATM
+      CHECK_EQUAL(0x199, uint16_t(etl::crc<10, 0x233, 0x000, false, false, 0x000>(data.begin(), data.end())));
+
+      // CRC-7/MMC
+      CHECK_EQUAL(0x75, int(etl::crc<7, 0x09, 0x00, false, false, 0x00>(data.begin(), data.end())));
+
+      // CRC-5/USB
+      CHECK_EQUAL(0x19, int(etl::crc<5, 0x05, 0x1F, true, true, 0x1F>(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    template <typename TCrc1, typename TCrc8>
+    void check_slice_by_8_and_combine(const std::vector<uint8_t>& data)
+    {
+      const uint8_t* begin = data.data();
+
+      for (size_t length = 0; length < data.size(); length += 7)
+      {
+        typename TCrc1::value_type crc1 = TCrc1(begin, begin + length);
+        typename TCrc8::value_type crc8 = TCrc8(begin, begin + length);
+
+        CHECK_EQUAL(uint64_t(crc1), uint64_t(crc8));
+
+        typename TCrc1::value_type crc_a = TCrc1(begin, begin + (length / 3));
+        typename TCrc1::value_type crc_b = TCrc1(begin + (length / 3), begin + length);
+
+        CHECK_EQUAL(uint64_t(crc1), uint64_t(TCrc1::combine(crc_a, crc_b, length - (length / 3))));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc_generic_slice_by_8_and_combine)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.push_back(uint8_t(i * 11 + 3));
+      }
+
+      check_slice_by_8_and_combine<etl::crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>,
+                                   etl::crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, etl::endian::little, etl::crc_slice_by_8> >(data);
+
+      check_slice_by_8_and_combine<etl::crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF>,
+                                   etl::crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, etl::endian::little, etl::crc_slice_by_8> >(data);
+
+      check_slice_by_8_and_combine<etl::crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>,
+                                   etl::crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000, etl::endian::little, etl::crc_slice_by_8> >(data);
+
+      check_slice_by_8_and_combine<etl::crc<12, 0x80F, 0x000, false, true, 0x000>,
+                                   etl::crc<12, 0x80F, 0x000, false, true, 0x000, etl::endian::little, etl::crc_slice_by_8> >(data);
+
+      check_slice_by_8_and_combine<etl::crc<5, 0x05, 0x1F, true, true, 0x1F>,
+                                   etl::crc<5, 0x05, 0x1F, true, true, 0x1F, etl::endian::little, etl::crc_slice_by_8> >(data);
+
+      check_slice_by_8_and_combine<etl::crc16_ccitt<>, etl::crc16_ccitt<etl::endian::little, etl::crc_slice_by_8> >(data);
+      check_slice_by_8_and_combine<etl::crc16_kermit<>, etl::crc16_kermit<etl::endian::little, etl::crc_slice_by_8> >(data);
+      check_slice_by_8_and_combine<etl::crc8_ccitt<>, etl::crc8_ccitt<etl::endian::little, etl::crc_slice_by_8> >(data);
+      check_slice_by_8_and_combine<etl::crc64_ecma<>, etl::crc64_ecma<etl::endian::little, etl::crc_slice_by_8> >(data);
+    }
+
+    //*************************************************************************
+    template <typename TCrc1, typename TCrcHardware>
+    void check_hardware(const std::vector<uint8_t>& data)
+    {
+      // Every length up to a few fold blocks, from every offset within a block.
+      for (size_t offset = 0; offset < 16; ++offset)
+      {
+        const uint8_t* begin = data.data() + offset;
+
+        for (size_t length = 0; length <= 300; ++length)
+        {
+          typename TCrc1::value_type        crc1 = TCrc1(begin, begin + length);
+          typename TCrcHardware::value_type crc2 = TCrcHardware(begin, begin + length);
+
+          CHECK_EQUAL(uint64_t(crc1), uint64_t(crc2));
+        }
+      }
+
+      // The register carries over between ranges.
+      TCrcHardware crc_calculator;
+      crc_calculator.add(data.begin(), data.begin() + 100);
+      crc_calculator.add(data[100]);
+      crc_calculator.add(data.data() + 101, data.data() + data.size());
+
+      CHECK_EQUAL(uint64_t(TCrc1(data.begin(), data.end()).value()), uint64_t(crc_calculator.value()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_hardware_matches_tables)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 4096; ++i)
+      {
+        data.push_back(uint8_t((i * 131) ^ (i >> 5)));
+      }
+
+      check_hardware<etl::crc32<>, etl::crc32<etl::endian::little, etl::crc_hardware> >(data);
+      check_hardware<etl::crc32_c<>, etl::crc32_c<etl::endian::little, etl::crc_hardware> >(data);
+      check_hardware<etl::crc64_ecma<>, etl::crc64_ecma<etl::endian::little, etl::crc_hardware> >(data);
+
+      // CRC-32/BZIP2 is normal and CRC-64/XZ is reflected.
+      check_hardware<etl::crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>,
+                     etl::crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, etl::endian::little, etl::crc_hardware> >(data);
+
+      check_hardware<etl::crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF>,
+                     etl::crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, etl::endian::little, etl::crc_hardware> >(data);
+
+      // Widths that the instructions do not cover use the tables.
+      check_hardware<etl::crc16_ccitt<>, etl::crc16_ccitt<etl::endian::little, etl::crc_hardware> >(data);
+      check_hardware<etl::crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>,
+                     etl::crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000, etl::endian::little, etl::crc_hardware> >(data);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_hardware_check_values)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xCBF43926U, uint32_t(etl::crc32<etl::endian::little, etl::crc_hardware>(data.begin(), data.end())));
+      CHECK_EQUAL(0xE3069283U, uint32_t(etl::crc32_c<etl::endian::little, etl::crc_hardware>(data.begin(), data.end())));
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, uint64_t(etl::crc64_ecma<etl::endian::little, etl::crc_hardware>(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_add_range_endian_pointers)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605, 0x0C0B0A09 };
+      std::vector<uint32_t> data3 = { 0x01020304, 0x05060708, 0x090A0B0C };
+
+      uint32_t crc1 = etl::crc32<etl::endian::little>(data1.data(), data1.data() + data1.size());
+      uint32_t crc2 = etl::crc32<etl::endian::little>(data2.data(), data2.data() + data2.size());
+      CHECK_EQUAL(crc1, crc2);
+
+      uint32_t crc3 = etl::crc32<etl::endian::big>(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(crc1, crc3);
+
+      uint32_t crc4 = etl::crc32<etl::endian::big, etl::crc_slice_by_8>(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(crc1, crc4);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_add_range_volatile)
+    {
+      const uint32_t          data1[] = { 0x04030201, 0x08070605 };
+      volatile const uint32_t data2[] = { 0x04030201, 0x08070605 };
+
+      // Volatile values are read one at a time.
+      etl::crc32<> crc_calculator;
+      crc_calculator.add(data2, data2 + 2);
+      CHECK_EQUAL(uint32_t(etl::crc32<>(data1, data1 + 2)), crc_calculator.value());
+
+      uint64_t crc = etl::crc64_ecma<etl::endian::little, etl::crc_slice_by_8>(data2, data2 + 2);
+      CHECK_EQUAL(uint64_t(etl::crc64_ecma<>(data1, data1 + 2)), crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_add_words)
+    {
+      std::vector<uint8_t> data = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xF9, 0xFA, 0xFB, 0xFC };
+
+      uint64_t crc1 = etl::crc64_ecma<>(data.begin(), data.end());
+
+      etl::crc64_ecma<etl::endian::little, etl::crc_slice_by_8> crc_little;
+      crc_little.add(uint64_t(0x0807060504030201));
+      crc_little.add(int32_t(0xFCFBFAF9));
+      CHECK_EQUAL(crc1, crc_little.value());
+
+      etl::crc64_ecma<etl::endian::big> crc_big;
+      crc_big.add(uint64_t(0x0102030405060708));
+      crc_big.add(int16_t(0xF9FA));
+      crc_big.add(uint16_t(0xFBFC));
+      CHECK_EQUAL(crc1, crc_big.value());
+
+      uint16_t crc2 = etl::crc16_ccitt<>(data.begin(), data.end());
+
+      etl::crc16_ccitt<etl::endian::little, etl::crc_slice_by_8> crc16_little;
+      crc16_little.add(uint32_t(0x04030201));
+      crc16_little.add(uint64_t(0xFCFBFAF908070605));
+      CHECK_EQUAL(crc2, crc16_little.value());
+    }
+
     //*************************************************************************
     TEST(test_crc64_ecma)
     {
@@ -378,6 +822,19 @@ namespace
       uint64_t crc3 = etl::crc64_ecma<etl::endian::big>(data3.begin(), data3.end());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_combine)
+    {
+      std::string data("123456789");
+
+      uint64_t crc_a = etl::crc64_ecma<>(data.begin(), data.begin() + 4);
+      uint64_t crc_b = etl::crc64_ecma<>(data.begin() + 4, data.end());
+
+      uint64_t crc = etl::crc64_ecma<>::combine(crc_a, crc_b, data.size() - 4);
+
+      CHECK_EQUAL(0x6C40DF5F0B497347, crc);
+    }
   };
 }
 
@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include <vector>
 #include <algorithm>
+#include <memory>
 
 const size_t SIZE = 6;
 
@@ -1231,5 +1232,64 @@ namespace
 
       CHECK(deque1 != deque2);
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::deque<Item, SIZE> data;
+
+      data.push_back(Item(new int(2)));
+      data.push_front(Item(new int(0)));
+      data.emplace_back(new int(5));
+      data.emplace_front(new int(-1));
+      data.insert(data.begin() + 2, Item(new int(1)));
+      data.emplace(data.begin() + 4, new int(3));
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK_EQUAL(-1, *data[0]);
+      CHECK_EQUAL(0,  *data[1]);
+      CHECK_EQUAL(1,  *data[2]);
+      CHECK_EQUAL(2,  *data[3]);
+      CHECK_EQUAL(3,  *data[4]);
+      CHECK_EQUAL(5,  *data[5]);
+
+      data.erase(data.begin() + 1);
+      data.erase(data.begin() + 3);
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(-1, *data[0]);
+      CHECK_EQUAL(1,  *data[1]);
+      CHECK_EQUAL(2,  *data[2]);
+      CHECK_EQUAL(5,  *data[3]);
+    }
+    //*************************************************************************
+    TEST(test_index_power_of_two_buffer)
+    {
+      // The buffer holds MAX_SIZE + 1 items, so this one is masked.
+      etl::deque<int, 7> data;
+      etl::ideque<int>& idata = data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        if (data.full())
+        {
+          data.pop_front();
+        }
+
+        data.push_back(i);
+
+        for (size_t j = 0; j < data.size(); ++j)
+        {
+          CHECK_EQUAL(idata[j], data[j]);
+          CHECK_EQUAL(*(idata.begin() + j), data.at(j));
+        }
+      }
+
+      CHECK_EQUAL(13, data[0]);
+      CHECK_EQUAL(19, data[6]);
+      CHECK_THROW(data.at(7), etl::deque_out_of_bounds);
+    }
 	};
 }
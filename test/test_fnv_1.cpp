@@ -32,6 +32,7 @@ SOFTWARE.
 #include <stdint.h>
 
 #include "../fnv_1.h"
+#include "../fnv_1_batch.h"
 #include "../endian.h"
 
 namespace
@@ -261,6 +262,170 @@ namespace
       uint64_t hash3 = etl::fnv_1a_64<etl::endian::big>(data3.begin(), data3.end());
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_fnv_1a_64_add_range_endian_pointers)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint32_t> data3 = { 0x01020304, 0x05060708 };
+      uint64_t              data4 = 0x0807060504030201;
+
+      uint64_t hash1 = etl::fnv_1a_64<etl::endian::little>(data1.data(), data1.data() + data1.size());
+      uint64_t hash2 = etl::fnv_1a_64<etl::endian::little>(data2.data(), data2.data() + data2.size());
+      CHECK_EQUAL(hash1, hash2);
+
+      uint64_t hash3 = etl::fnv_1a_64<etl::endian::big>(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(hash1, hash3);
+
+      etl::fnv_1a_64<> fnv_1a_64_calculator;
+      fnv_1a_64_calculator.add(data4);
+      CHECK_EQUAL(hash1, fnv_1a_64_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1_32_add_range_endian_pointers)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint32_t> data3 = { 0x01020304, 0x05060708 };
+
+      uint32_t hash1 = etl::fnv_1_32<etl::endian::little>(data1.data(), data1.data() + data1.size());
+      uint32_t hash2 = etl::fnv_1_32<etl::endian::little>(data2.data(), data2.data() + data2.size());
+      CHECK_EQUAL(hash1, hash2);
+
+      uint32_t hash3 = etl::fnv_1_32<etl::endian::big>(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(hash1, hash3);
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1_add_range_volatile)
+    {
+      const uint32_t          data1[] = { 0x04030201, 0x08070605 };
+      volatile const uint32_t data2[] = { 0x04030201, 0x08070605 };
+
+      CHECK_EQUAL(uint32_t(etl::fnv_1_32<>(data1, data1 + 2)),  uint32_t(etl::fnv_1_32<>(data2, data2 + 2)));
+      CHECK_EQUAL(uint32_t(etl::fnv_1a_32<>(data1, data1 + 2)), uint32_t(etl::fnv_1a_32<>(data2, data2 + 2)));
+      CHECK_EQUAL(uint64_t(etl::fnv_1_64<>(data1, data1 + 2)),  uint64_t(etl::fnv_1_64<>(data2, data2 + 2)));
+      CHECK_EQUAL(uint64_t(etl::fnv_1a_64<>(data1, data1 + 2)), uint64_t(etl::fnv_1a_64<>(data2, data2 + 2)));
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1a_batch)
+    {
+      // Enough keys for several full groups and a partial one, of mixed lengths.
+      std::vector<std::vector<uint8_t> > data;
+
+      for (size_t i = 0; i < 75; ++i)
+      {
+        std::vector<uint8_t> key;
+
+        for (size_t j = 0; j < ((i * 7) % 41); ++j)
+        {
+          key.push_back(uint8_t((i * 31) + (j * 17)));
+        }
+
+        data.push_back(key);
+      }
+
+      std::vector<const uint8_t*> keys;
+      std::vector<size_t>         lengths;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        keys.push_back(data[i].data());
+        lengths.push_back(data[i].size());
+      }
+
+      std::vector<uint32_t> hashes32(data.size());
+      std::vector<uint64_t> hashes64(data.size());
+
+      etl::fnv_1a_32_batch(keys.data(), lengths.data(), keys.size(), hashes32.data());
+      etl::fnv_1a_64_batch(keys.data(), lengths.data(), keys.size(), hashes64.data());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(uint32_t(etl::fnv_1a_32<>(data[i].begin(), data[i].end())), hashes32[i]);
+        CHECK_EQUAL(uint64_t(etl::fnv_1a_64<>(data[i].begin(), data[i].end())), hashes64[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1a_batch_fixed_length)
+    {
+      const size_t KEY_LENGTH = 13;
+      const size_t COUNT      = 37;
+
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0; i < (KEY_LENGTH * COUNT); ++i)
+      {
+        data.push_back(uint8_t((i * 131) ^ (i >> 3)));
+      }
+
+      std::vector<uint32_t> hashes32(COUNT);
+      std::vector<uint64_t> hashes64(COUNT);
+
+      etl::fnv_1a_32_batch(data.data(), KEY_LENGTH, COUNT, hashes32.data());
+      etl::fnv_1a_64_batch(data.data(), KEY_LENGTH, COUNT, hashes64.data());
+
+      for (size_t i = 0; i < COUNT; ++i)
+      {
+        const uint8_t* key = data.data() + (i * KEY_LENGTH);
+
+        CHECK_EQUAL(uint32_t(etl::fnv_1a_32<>(key, key + KEY_LENGTH)), hashes32[i]);
+        CHECK_EQUAL(uint64_t(etl::fnv_1a_64<>(key, key + KEY_LENGTH)), hashes64[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1_string_compile_time)
+    {
+      static_assert(etl::fnv_1_32_string("123456789")  == 0x24148816,         "fnv_1_32_string");
+      static_assert(etl::fnv_1a_32_string("123456789") == 0xBB86B11C,         "fnv_1a_32_string");
+      static_assert(etl::fnv_1_64_string("123456789")  == 0xA72FFC362BF916D6, "fnv_1_64_string");
+      static_assert(etl::fnv_1a_64_string("123456789") == 0x06D5573923C6CDFC, "fnv_1a_64_string");
+
+      const char* names[] = { "start", "stop", "reset", "unknown" };
+      int         results[4];
+
+      for (int i = 0; i < 4; ++i)
+      {
+        switch (etl::fnv_1a_32_string(names[i]))
+        {
+          case etl::fnv_1a_32_string("start"): results[i] = 1; break;
+          case etl::fnv_1a_32_string("stop"):  results[i] = 2; break;
+          case etl::fnv_1a_32_string("reset"): results[i] = 3; break;
+          default:                             results[i] = 0; break;
+        }
+      }
+
+      CHECK_EQUAL(1, results[0]);
+      CHECK_EQUAL(2, results[1]);
+      CHECK_EQUAL(3, results[2]);
+      CHECK_EQUAL(0, results[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_fnv_1_string_runtime_equivalence)
+    {
+      const char* texts[] = { "", "a", "123456789", "The quick brown fox jumps over the lazy dog", "\x80\xFF high bit" };
+
+      for (size_t i = 0; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        std::string text(texts[i]);
+
+        CHECK_EQUAL(uint32_t(etl::fnv_1_32<>(text.begin(), text.end())),  etl::fnv_1_32_string(texts[i]));
+        CHECK_EQUAL(uint32_t(etl::fnv_1a_32<>(text.begin(), text.end())), etl::fnv_1a_32_string(texts[i]));
+        CHECK_EQUAL(uint64_t(etl::fnv_1_64<>(text.begin(), text.end())),  etl::fnv_1_64_string(texts[i]));
+        CHECK_EQUAL(uint64_t(etl::fnv_1a_64<>(text.begin(), text.end())), etl::fnv_1a_64_string(texts[i]));
+      }
+
+      constexpr uint64_t hash = etl::fnv_1a_64_string("The quick brown fox jumps over the lazy dog");
+      std::string text("The quick brown fox jumps over the lazy dog");
+
+      CHECK_EQUAL(uint64_t(etl::fnv_1a_64<>(text.begin(), text.end())), hash);
+    }
   };
 }
 
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <array>
 #include <forward_list>
 #include <vector>
+#include <memory>
 
 namespace 
 {		
@@ -549,5 +550,27 @@ namespace
       are_equal = std::equal(second.begin(), second.end(), unsorted_data.begin());
       CHECK(are_equal);
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::forward_list<Item, SIZE> data;
+
+      data.push_front(Item(new int(3)));
+      data.emplace_front(new int(0));
+      data.insert_after(data.begin(), Item(new int(2)));
+      data.emplace_after(data.begin(), new int(1));
+
+      CHECK_EQUAL(4U, data.size());
+
+      int expected = 0;
+
+      for (etl::forward_list<Item, SIZE>::iterator i_item = data.begin(); i_item != data.end(); ++i_item)
+      {
+        CHECK_EQUAL(expected++, **i_item);
+      }
+    }
   };
 }
@@ -35,6 +35,18 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  // A policy that returns the number of bytes it was given.
+  //***************************************************************************
+  struct length_policy
+  {
+    template <typename TIterator>
+    static size_t hash(TIterator begin, TIterator end)
+    {
+      return size_t(end - begin);
+    }
+  };
+
   SUITE(test_hash)
   {
     //*************************************************************************
@@ -159,6 +171,40 @@ namespace
 
       CHECK_EQUAL(size_t(&i), hash);
     }
+
+    //*************************************************************************
+    TEST(test_hash_policy)
+    {
+      // long double is wider than size_t, so it is passed to the policy.
+      CHECK_EQUAL(sizeof(long double), (etl::hash<long double, length_policy>()(1.5)));
+
+      CHECK_EQUAL(0x5A5AU, (etl::hash<int, length_policy>()(0x5A5A)));
+
+      uint8_t data[] = { 'a', 'b', 'c' };
+      CHECK_EQUAL(size_t(0x44BC2CF5AD770999), etl::hash_policy_xxhash64::hash(data, data + sizeof(data)));
+    }
+
+    //*************************************************************************
+    TEST(test_hash_range)
+    {
+      std::string data("abc");
+
+      size_t hash1 = etl::hash_range(data.begin(), data.end());
+      size_t hash2 = etl::hash_range<etl::hash_policy_xxhash64>(data.begin(), data.end());
+      size_t hash3 = etl::hash_range<etl::hash_policy_xxhash64>(data.c_str(), data.c_str() + data.size());
+
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        CHECK_EQUAL(size_t(etl::fnv_1a_64<>(data.begin(), data.end()).value()), hash1);
+      }
+      else
+      {
+        CHECK_EQUAL(size_t(etl::fnv_1a_32<>(data.begin(), data.end()).value()), hash1);
+      }
+
+      CHECK_EQUAL(size_t(0x44BC2CF5AD770999), hash2);
+      CHECK_EQUAL(hash2, hash3);
+    }
   };
 }
 
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <array>
 #include <list>
 #include <vector>
+#include <memory>
 
 namespace 
 {		
@@ -774,5 +775,34 @@ namespace
       are_equal = std::equal(second.begin(), second.end(), unsorted_data.begin());
       CHECK(are_equal);
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::list<Item, SIZE> data;
+
+      data.push_back(Item(new int(2)));
+      data.push_front(Item(new int(0)));
+      data.emplace_back(new int(4));
+      data.emplace_front(new int(-1));
+
+      etl::list<Item, SIZE>::iterator i_item = data.begin();
+      ++i_item;
+      ++i_item;
+      data.insert(i_item, Item(new int(1)));
+      ++i_item;
+      data.emplace(i_item, new int(3));
+
+      CHECK_EQUAL(6U, data.size());
+
+      int expected = -1;
+
+      for (i_item = data.begin(); i_item != data.end(); ++i_item)
+      {
+        CHECK_EQUAL(expected++, **i_item);
+      }
+    }
   };
 }
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <memory>
 
 #include "../lookup.h"
 
@@ -522,5 +523,27 @@ namespace
       CHECK(Check_Equal(data1.begin(), data1.end(), second.begin()));
       CHECK(Check_Equal(data2.begin(), data2.end(), first.begin()));
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::lookup<std::string, Item, SIZE> data;
+
+      data.insert(std::make_pair(std::string("b"), Item(new int(2))));
+      data.emplace(std::string("a"), Item(new int(1)));
+      data.emplace(std::string("c"), Item(new int(3)));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, *data.find("a")->second);
+      CHECK_EQUAL(2, *data.find("b")->second);
+      CHECK_EQUAL(3, *data.find("c")->second);
+
+      // Replace an existing value.
+      data.emplace(std::string("b"), Item(new int(20)));
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(20, *data.find("b")->second);
+    }
   };
 }
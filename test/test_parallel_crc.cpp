@@ -0,0 +1,180 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <stdint.h>
+
+#include "../parallel_crc.h"
+#include "../crc8_ccitt.h"
+#include "../crc16.h"
+#include "../crc16_ccitt.h"
+#include "../crc16_kermit.h"
+#include "../crc32.h"
+#include "../crc64_ecma.h"
+
+namespace
+{
+  //***************************************************************************
+  // Runs each task on its own thread.
+  //***************************************************************************
+  struct thread_executor
+  {
+    template <typename TTask>
+    void operator ()(TTask* tasks, size_t count)
+    {
+      std::vector<std::thread> threads;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        threads.push_back(std::thread(std::ref(tasks[i])));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      ++calls;
+    }
+
+    int calls = 0;
+  };
+
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      data.push_back(uint8_t((i * 31) ^ (i >> 8)));
+    }
+
+    return data;
+  }
+
+  SUITE(test_parallel_crc)
+  {
+    //*************************************************************************
+    TEST(test_below_threshold)
+    {
+      std::vector<uint8_t> data = make_data(1000);
+      thread_executor executor;
+
+      etl::parallel_crc<etl::crc32<> > crc_calculator(1001);
+
+      uint32_t crc = crc_calculator.calculate(data.begin(), data.end(), executor);
+
+      CHECK_EQUAL(uint32_t(etl::crc32<>(data.begin(), data.end())), crc);
+      CHECK_EQUAL(0, executor.calls);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_threads)
+    {
+      std::vector<uint8_t> data = make_data(100003);
+      thread_executor executor;
+
+      etl::parallel_crc<etl::crc32<>, 8> crc_calculator(1000);
+
+      uint32_t crc = crc_calculator.calculate(data.begin(), data.end(), executor);
+
+      CHECK_EQUAL(uint32_t(etl::crc32<>(data.begin(), data.end())), crc);
+      CHECK_EQUAL(1, executor.calls);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8_pointers)
+    {
+      std::vector<uint8_t> data = make_data(100003);
+      thread_executor executor;
+
+      typedef etl::crc32<etl::endian::little, etl::crc_slice_by_8> crc_t;
+      etl::parallel_crc<crc_t, 4> crc_calculator(0);
+
+      const uint8_t* begin = data.data();
+      const uint8_t* end   = begin + data.size();
+
+      uint32_t crc = crc_calculator.calculate(begin, end, executor);
+
+      CHECK_EQUAL(uint32_t(etl::crc32<>(begin, end)), crc);
+    }
+
+    //*************************************************************************
+    TEST(test_all_crc_types)
+    {
+      std::vector<uint8_t> data = make_data(5000);
+      thread_executor executor;
+
+      CHECK_EQUAL(int(etl::crc8_ccitt<>(data.begin(), data.end())), int(etl::parallel_crc<etl::crc8_ccitt<> >(0).calculate(data.begin(), data.end(), executor)));
+      CHECK_EQUAL(etl::crc16<>(data.begin(), data.end()),           etl::parallel_crc<etl::crc16<> >(0).calculate(data.begin(), data.end(), executor));
+      CHECK_EQUAL(etl::crc16_ccitt<>(data.begin(), data.end()),     etl::parallel_crc<etl::crc16_ccitt<> >(0).calculate(data.begin(), data.end(), executor));
+      CHECK_EQUAL(etl::crc16_kermit<>(data.begin(), data.end()),    etl::parallel_crc<etl::crc16_kermit<> >(0).calculate(data.begin(), data.end(), executor));
+      CHECK_EQUAL(etl::crc64_ecma<>(data.begin(), data.end()),      etl::parallel_crc<etl::crc64_ecma<> >(0).calculate(data.begin(), data.end(), executor));
+    }
+
+    //*************************************************************************
+    TEST(test_wide_elements)
+    {
+      std::vector<uint32_t> data;
+
+      for (uint32_t i = 0; i < 1001; ++i)
+      {
+        data.push_back(i * 0x01010101);
+      }
+
+      etl::parallel_crc<etl::crc32<>, 3> crc_calculator(0);
+
+      uint32_t crc = crc_calculator.calculate(data.begin(), data.end());
+
+      CHECK_EQUAL(uint32_t(etl::crc32<>(data.begin(), data.end())), crc);
+    }
+
+    //*************************************************************************
+    TEST(test_fewer_elements_than_chunks)
+    {
+      std::string data("123456789");
+
+      etl::parallel_crc<etl::crc32<>, 16> crc_calculator(0);
+
+      CHECK_EQUAL(0xCBF43926, crc_calculator.calculate(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_range)
+    {
+      std::string data;
+
+      etl::parallel_crc<etl::crc32<>, 4> crc_calculator(0);
+
+      CHECK_EQUAL(0x00000000, crc_calculator.calculate(data.begin(), data.end()));
+    }
+  };
+}
@@ -26,6 +26,9 @@ SOFTWARE.
 
 #include <UnitTest++/UnitTest++.h>
 
+#include <vector>
+#include <algorithm>
+
 #include "../pool.h"
 
 struct Test_Data
@@ -34,6 +37,53 @@ struct Test_Data
   char c;
 };
 
+// Not default constructible. Counts the live instances.
+struct Test_Object
+{
+  Test_Object(int i, char c)
+    : i(i),
+      c(c)
+  {
+    ++instances;
+  }
+
+  Test_Object(const Test_Object& other)
+    : i(other.i),
+      c(other.c)
+  {
+    ++instances;
+  }
+
+  ~Test_Object()
+  {
+    --instances;
+  }
+
+  int  i;
+  char c;
+
+  static int instances;
+};
+
+int Test_Object::instances = 0;
+
+// Throws from its constructor when asked to.
+struct Test_Throwing
+{
+  Test_Throwing(bool do_throw)
+  {
+    if (do_throw)
+    {
+      throw 0;
+    }
+  }
+};
+
+struct alignas(32) Test_Over_Aligned
+{
+  float f[8];
+};
+
 namespace
 {
   SUITE(test_pool)
@@ -189,5 +239,193 @@ namespace
       CHECK(pool.is_in_pool(p1));
       CHECK(!pool.is_in_pool(not_in_pool));
     }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      Test_Object::instances = 0;
+
+      {
+        etl::pool<Test_Object, 4> pool;
+
+        // Nothing is constructed until it is created.
+        CHECK_EQUAL(0, Test_Object::instances);
+
+        Test_Object* p1 = pool.create(1, 'a');
+        Test_Object* p2 = pool.create(2, 'b');
+        Test_Object* p3 = pool.create(*p1);
+
+        CHECK_EQUAL(3, Test_Object::instances);
+        CHECK_EQUAL(1, pool.available());
+
+        CHECK_EQUAL(1,   p1->i);
+        CHECK_EQUAL('a', p1->c);
+        CHECK_EQUAL(2,   p2->i);
+        CHECK_EQUAL('b', p2->c);
+        CHECK_EQUAL(1,   p3->i);
+        CHECK_EQUAL('a', p3->c);
+
+        CHECK_NO_THROW(pool.destroy(p2));
+        CHECK_EQUAL(2, Test_Object::instances);
+        CHECK_EQUAL(2, pool.available());
+
+        Test_Object* p4 = pool.create(4, 'd');
+        CHECK(p4 == p2);
+        CHECK_EQUAL(4, p4->i);
+
+        Test_Object not_in_pool(5, 'e');
+        CHECK_THROW(pool.destroy(&not_in_pool), etl::pool_object_not_in_pool);
+        CHECK_EQUAL(4, Test_Object::instances);
+
+        pool.destroy(p1);
+        pool.destroy(p3);
+        pool.destroy(p4);
+
+        CHECK_EQUAL(1, Test_Object::instances);
+        CHECK_EQUAL(4, pool.available());
+
+        pool.create(6, 'f');
+        pool.create(7, 'g');
+        pool.create(8, 'h');
+        pool.create(9, 'i');
+
+        CHECK_THROW(pool.create(10, 'j'), etl::pool_no_allocation);
+        CHECK_EQUAL(5, Test_Object::instances);
+      }
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      etl::pool<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+
+      pool.release(p2);
+      pool.release(p3);
+
+      pool.allocate();
+      pool.allocate();
+      pool.allocate();
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      pool.release(p1);
+
+      etl::pool_statistics statistics = pool.get_statistics();
+
+      CHECK_EQUAL(4U, statistics.max_size);
+      CHECK_EQUAL(3U, statistics.in_use);
+      CHECK_EQUAL(4U, statistics.high_water);
+      CHECK_EQUAL(6U, statistics.allocations);
+      CHECK_EQUAL(3U, statistics.releases);
+      CHECK_EQUAL(2U, statistics.failures);
+
+#if defined(ETL_POOL_LATENCY_HISTOGRAM)
+      size_t allocate_total = 0;
+      size_t release_total  = 0;
+
+      for (size_t i = 0; i < ETL_POOL_LATENCY_BUCKETS; ++i)
+      {
+        allocate_total += statistics.allocate_latency[i];
+        release_total  += statistics.release_latency[i];
+      }
+
+      CHECK_EQUAL(6U, allocate_total);
+      CHECK_EQUAL(3U, release_total);
+#endif
+
+      pool.reset_statistics();
+      statistics = pool.get_statistics();
+
+      CHECK_EQUAL(3U, statistics.in_use);
+      CHECK_EQUAL(3U, statistics.high_water);
+      CHECK_EQUAL(0U, statistics.allocations);
+      CHECK_EQUAL(0U, statistics.releases);
+      CHECK_EQUAL(0U, statistics.failures);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_allocate_release_large)
+    {
+      // Large enough for three levels in the free map.
+      const size_t SIZE = 5000;
+
+      etl::pool<Test_Data, SIZE> pool;
+      std::vector<Test_Data*> allocated;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        allocated.push_back(pool.allocate());
+        CHECK_EQUAL(SIZE - i - 1, pool.available());
+      }
+
+      CHECK(pool.empty());
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      std::vector<Test_Data*> sorted(allocated);
+      std::sort(sorted.begin(), sorted.end());
+      CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+      // Release a scattered set and check that each one is reused.
+      const size_t released[] = { 4999, 31, 32, 1023, 1024, 0, 2500 };
+      const size_t n_released = sizeof(released) / sizeof(released[0]);
+
+      for (size_t i = 0; i < n_released; ++i)
+      {
+        pool.release(allocated[released[i]]);
+      }
+
+      CHECK_EQUAL(n_released, pool.available());
+
+      std::vector<Test_Data*> expected;
+
+      for (size_t i = 0; i < n_released; ++i)
+      {
+        expected.push_back(allocated[released[i]]);
+      }
+
+      std::sort(expected.begin(), expected.end());
+
+      // The lowest free item is always allocated first.
+      for (size_t i = 0; i < n_released; ++i)
+      {
+        CHECK(pool.allocate() == expected[i]);
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_throwing_constructor)
+    {
+      etl::pool<Test_Throwing, 2> pool;
+
+      CHECK_THROW(pool.create(true), int);
+
+      // The item is given back.
+      CHECK_EQUAL(2U, pool.available());
+
+      pool.create(false);
+      pool.create(false);
+      CHECK_EQUAL(0U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_over_aligned)
+    {
+      etl::pool<Test_Over_Aligned, 4> pool;
+
+      Test_Over_Aligned* p1 = pool.create();
+      Test_Over_Aligned* p2 = pool.create();
+
+      CHECK((size_t(p1) % 32) == 0);
+      CHECK((size_t(p2) % 32) == 0);
+    }
   };
 }
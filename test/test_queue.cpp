@@ -27,6 +27,10 @@ SOFTWARE.
 #include <UnitTest++/UnitTest++.h>
 
 #include <queue>
+#include <list>
+#include <memory>
+#include <vector>
+#include <iterator>
 
 #include "../queue.h"
 
@@ -327,5 +331,137 @@ namespace
         stack2.pop();
       }
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::queue<Item, 4> queue;
+
+      queue.push(Item(new int(1)));
+      queue.emplace(new int(2));
+
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(1, *queue.front());
+      CHECK_EQUAL(2, *queue.back());
+
+      queue.pop();
+      CHECK_EQUAL(2, *queue.front());
+    }
+
+    //*************************************************************************
+    TEST(test_push_range)
+    {
+      etl::queue<int, 5> queue;
+
+      const int data[] = { 1, 2, 3, 4, 5, 6 };
+
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+
+      // Wraps around the end of the buffer.
+      queue.push(data, data + 4);
+      CHECK_EQUAL(4U, queue.size());
+
+      // Too many.
+      CHECK_THROW(queue.push(data, data + 2), etl::queue_full);
+      CHECK_EQUAL(4U, queue.size());
+
+      // From a non-contiguous range.
+      std::list<int> more(1, 5);
+      queue.push(more.begin(), more.end());
+      CHECK(queue.full());
+
+      for (int i = 1; i <= 5; ++i)
+      {
+        CHECK_EQUAL(i, queue.front());
+        queue.pop();
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into)
+    {
+      etl::queue<int, 5> queue;
+
+      const int data[] = { 1, 2, 3, 4, 5 };
+
+      queue.push(data, data + 3);
+      queue.pop();
+      queue.pop();
+      queue.push(data + 3, data + 5);
+
+      // 3, 4, 5, wrapping around the end of the buffer.
+      int output[5] = { 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(2U, queue.pop_into(output, 2));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK_EQUAL(0, output[2]);
+
+      std::vector<int> rest;
+      CHECK_EQUAL(1U, queue.pop_into(std::back_inserter(rest), 10));
+      CHECK_EQUAL(1U, rest.size());
+      CHECK_EQUAL(5, rest[0]);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop_into(output, 10));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into_move_only)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::queue<Item, 4> queue;
+
+      queue.emplace(new int(1));
+      queue.emplace(new int(2));
+
+      Item output[2];
+
+      CHECK_EQUAL(2U, queue.pop_into(output, 2));
+      CHECK_EQUAL(1, *output[0]);
+      CHECK_EQUAL(2, *output[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_peek_spans)
+    {
+      typedef etl::iqueue<int>::span span;
+
+      etl::queue<int, 4> queue;
+
+      std::pair<span, span> spans = queue.peek_spans();
+      CHECK_EQUAL(0U, spans.first.size);
+      CHECK_EQUAL(0U, spans.second.size);
+
+      const int data[] = { 1, 2, 3, 4 };
+
+      queue.push(data, data + 3);
+      spans = queue.peek_spans();
+      CHECK_EQUAL(3U, spans.first.size);
+      CHECK_EQUAL(0U, spans.second.size);
+      CHECK_EQUAL(1, spans.first.data[0]);
+
+      // 3, 4, 1 wrapping around the end of the buffer.
+      CHECK_EQUAL(2U, queue.pop(2));
+      queue.push(data + 3, data + 4);
+      queue.push(data, data + 1);
+
+      const etl::queue<int, 4>& cqueue = queue;
+      std::pair<etl::iqueue<int>::const_span, etl::iqueue<int>::const_span> cspans = cqueue.peek_spans();
+      CHECK_EQUAL(2U, cspans.first.size);
+      CHECK_EQUAL(3, cspans.first.data[0]);
+      CHECK_EQUAL(4, cspans.first.data[1]);
+      CHECK_EQUAL(1U, cspans.second.size);
+      CHECK_EQUAL(1, cspans.second.data[0]);
+
+      CHECK_EQUAL(3U, queue.pop(10));
+      CHECK(queue.empty());
+    }
   };
 }
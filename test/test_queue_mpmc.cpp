@@ -0,0 +1,330 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "../queue_mpmc.h"
+
+namespace
+{
+  // Counts the live instances.
+  struct Counted
+  {
+    Counted(int value)
+      : value(value)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    Counted& operator =(const Counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  SUITE(test_queue_mpmc)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::queue_mpmc<int, 4> queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK_EQUAL(4U, queue.available());
+
+      queue.push(1);
+      queue.emplace(2);
+      CHECK(queue.try_push(3));
+      CHECK(queue.try_emplace(4));
+
+      CHECK(queue.full());
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      CHECK(!queue.try_push(5));
+      CHECK_THROW(queue.push(5), etl::queue_full);
+
+      int value;
+
+      for (int i = 1; i <= 4; ++i)
+      {
+        CHECK(queue.try_pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(!queue.try_pop(value));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::queue_mpmc<int, 4> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        while (queue.try_push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK_EQUAL(4U, queue.size());
+
+        int value;
+
+        for (int j = 0; j < 3; ++j)
+        {
+          CHECK(queue.try_pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_batch)
+    {
+      etl::queue_mpmc<int, 8> queue;
+
+      const int data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      // Only as many as there is room for.
+      CHECK_EQUAL(8U, queue.try_push(data, data + 10));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.try_push(data, data + 10));
+
+      int output[10];
+
+      CHECK_EQUAL(3U, queue.try_pop(output, 3));
+      CHECK_EQUAL(0, output[0]);
+      CHECK_EQUAL(2, output[2]);
+
+      CHECK_EQUAL(2U, queue.try_push(data + 8, data + 10));
+
+      // Only as many as there are.
+      CHECK_EQUAL(7U, queue.try_pop(output, 10));
+
+      for (int i = 0; i < 7; ++i)
+      {
+        CHECK_EQUAL(i + 3, output[i]);
+      }
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.try_pop(output, 10));
+    }
+
+    //*************************************************************************
+    TEST(test_move_only)
+    {
+      etl::queue_mpmc<std::unique_ptr<int>, 2> queue;
+
+      std::unique_ptr<int> p(new int(1));
+
+      CHECK(queue.try_push(std::move(p)));
+      queue.emplace(new int(2));
+
+      std::unique_ptr<int> result;
+
+      CHECK(queue.try_pop(result));
+      CHECK_EQUAL(1, *result);
+      CHECK(queue.try_pop(result));
+      CHECK_EQUAL(2, *result);
+    }
+
+    //*************************************************************************
+    TEST(test_only_queued_items_are_constructed)
+    {
+      Counted::instances = 0;
+
+      {
+        etl::queue_mpmc<Counted, 8> queue;
+
+        CHECK_EQUAL(0, Counted::instances);
+
+        queue.emplace(1);
+        queue.emplace(2);
+        queue.emplace(3);
+
+        CHECK_EQUAL(3, Counted::instances);
+
+        Counted value(0);
+        queue.try_pop(value);
+        CHECK_EQUAL(3, Counted::instances);
+      }
+
+      // The destructor destroys the remaining items.
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_many_threads)
+    {
+      const uint32_t N_PRODUCERS = 4;
+      const uint32_t N_CONSUMERS = 4;
+      const uint32_t N_ITEMS     = 100000; // Per producer.
+      const uint32_t BATCH       = 8;
+
+      etl::queue_mpmc<uint32_t, 64> queue;
+
+      // Each item holds its producer in the top byte and a count in the rest.
+      std::vector<std::thread> threads;
+      std::vector<uint32_t>    errors(N_CONSUMERS, 0);
+      std::vector<uint64_t>    sums(N_CONSUMERS, 0);
+
+      for (uint32_t p = 0; p < N_PRODUCERS; ++p)
+      {
+        threads.push_back(std::thread([&queue, p, N_ITEMS, BATCH]()
+        {
+          uint32_t i = 0;
+
+          while (i < N_ITEMS)
+          {
+            // Alternate between single and batch pushes.
+            if ((i & 1) == 0)
+            {
+              if (queue.try_push((p << 24) | i))
+              {
+                ++i;
+                continue;
+              }
+            }
+            else
+            {
+              uint32_t batch[BATCH];
+              uint32_t n = 0;
+
+              while ((n < BATCH) && ((i + n) < N_ITEMS))
+              {
+                batch[n] = (p << 24) | (i + n);
+                ++n;
+              }
+
+              const size_t pushed = queue.try_push(batch, batch + n);
+
+              if (pushed != 0)
+              {
+                i += uint32_t(pushed);
+                continue;
+              }
+            }
+
+            std::this_thread::yield();
+          }
+        }));
+      }
+
+      std::atomic<uint32_t> remaining(N_PRODUCERS * N_ITEMS);
+
+      for (uint32_t c = 0; c < N_CONSUMERS; ++c)
+      {
+        threads.push_back(std::thread([&, c]()
+        {
+          // The last count seen from each producer, plus one.
+          uint32_t next[N_PRODUCERS] = { 0 };
+          uint32_t batch[BATCH];
+
+          while (remaining.load() != 0)
+          {
+            const size_t n = queue.try_pop(batch, BATCH);
+
+            if (n == 0)
+            {
+              std::this_thread::yield();
+              continue;
+            }
+
+            remaining -= uint32_t(n);
+
+            for (size_t j = 0; j < n; ++j)
+            {
+              const uint32_t producer = batch[j] >> 24;
+              const uint32_t count    = batch[j] & 0xFFFFFF;
+
+              // Each consumer sees each producer's items in order.
+              if ((producer >= N_PRODUCERS) || (count < next[producer]))
+              {
+                ++errors[c];
+              }
+              else
+              {
+                next[producer] = count + 1;
+              }
+
+              sums[c] += count;
+            }
+          }
+        }));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      uint32_t total_errors = 0;
+      uint64_t total_sum    = 0;
+
+      for (uint32_t c = 0; c < N_CONSUMERS; ++c)
+      {
+        total_errors += errors[c];
+        total_sum    += sums[c];
+      }
+
+      CHECK_EQUAL(0U, total_errors);
+      CHECK_EQUAL(uint64_t(N_PRODUCERS) * (uint64_t(N_ITEMS) * (N_ITEMS - 1) / 2), total_sum);
+      CHECK(queue.empty());
+    }
+  };
+}
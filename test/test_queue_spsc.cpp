@@ -0,0 +1,218 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <memory>
+#include <thread>
+#include <stdint.h>
+
+#include "../queue_spsc.h"
+
+namespace
+{
+  // Counts the live instances.
+  struct Counted
+  {
+    Counted(int value)
+      : value(value)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    Counted& operator =(const Counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  SUITE(test_queue_spsc)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::queue_spsc<int, 4> queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.emplace(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.full());
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(1, *queue.front());
+
+      int value = 0;
+
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK(queue.pop());
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(4, value);
+      CHECK(!queue.pop(value));
+      CHECK(!queue.pop());
+      CHECK(queue.front() == nullptr);
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::queue_spsc<int, 4> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK_EQUAL(4U, queue.size());
+
+        int value;
+
+        for (int j = 0; j < 3; ++j)
+        {
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_move_only)
+    {
+      etl::queue_spsc<std::unique_ptr<int>, 2> queue;
+
+      std::unique_ptr<int> p(new int(1));
+
+      CHECK(queue.push(std::move(p)));
+      CHECK(queue.emplace(new int(2)));
+
+      std::unique_ptr<int> result;
+
+      CHECK(queue.pop(result));
+      CHECK_EQUAL(1, *result);
+      CHECK(queue.pop(result));
+      CHECK_EQUAL(2, *result);
+    }
+
+    //*************************************************************************
+    TEST(test_only_queued_items_are_constructed)
+    {
+      Counted::instances = 0;
+
+      {
+        etl::queue_spsc<Counted, 8> queue;
+
+        CHECK_EQUAL(0, Counted::instances);
+
+        queue.emplace(1);
+        queue.emplace(2);
+        queue.emplace(3);
+
+        CHECK_EQUAL(3, Counted::instances);
+
+        queue.pop();
+        CHECK_EQUAL(2, Counted::instances);
+      }
+
+      // The destructor destroys the remaining items.
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_two_threads)
+    {
+      const uint32_t N_ITEMS = 1000000;
+
+      etl::queue_spsc<uint32_t, 64> queue;
+
+      std::thread producer([&queue, N_ITEMS]()
+      {
+        for (uint32_t i = 0; i < N_ITEMS; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      uint32_t errors = 0;
+      uint32_t value;
+
+      for (uint32_t i = 0; i < N_ITEMS; ++i)
+      {
+        while (!queue.pop(value))
+        {
+          std::this_thread::yield();
+        }
+
+        if (value != i)
+        {
+          ++errors;
+        }
+      }
+
+      producer.join();
+
+      CHECK_EQUAL(0U, errors);
+      CHECK(queue.empty());
+    }
+  };
+}
@@ -0,0 +1,78 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include "../ring_index.h"
+
+namespace
+{
+  //***************************************************************************
+  // Checks the indexes against the modulo arithmetic.
+  //***************************************************************************
+  template <const size_t SIZE>
+  int check_ring_index()
+  {
+    typedef etl::ring_index<SIZE> ring_index;
+
+    int errors = 0;
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+      for (size_t n = 0; n <= SIZE; ++n)
+      {
+        errors += (ring_index::add(i, n) != ((i + n) % SIZE));
+      }
+    }
+
+    return errors;
+  }
+
+  SUITE(test_ring_index)
+  {
+    //*************************************************************************
+    TEST(test_power_of_two)
+    {
+      CHECK_EQUAL(0, check_ring_index<1>());
+      CHECK_EQUAL(0, check_ring_index<2>());
+      CHECK_EQUAL(0, check_ring_index<8>());
+      CHECK_EQUAL(0, check_ring_index<64>());
+
+      CHECK_EQUAL(7U, size_t(etl::ring_index<8>::MASK));
+    }
+
+    //*************************************************************************
+    TEST(test_not_power_of_two)
+    {
+      CHECK_EQUAL(0, check_ring_index<3>());
+      CHECK_EQUAL(0, check_ring_index<7>());
+      CHECK_EQUAL(0, check_ring_index<9>());
+      CHECK_EQUAL(0, check_ring_index<100>());
+    }
+  };
+}
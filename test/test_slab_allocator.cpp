@@ -0,0 +1,248 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <vector>
+#include <list>
+#include <map>
+#include <algorithm>
+#include <stdint.h>
+
+#include "../slab_allocator.h"
+
+namespace
+{
+  // Block sizes 8, 16, 32 and 64, with 4 of each.
+  typedef etl::slab_allocator<8, 64, 4> Slabs;
+
+  SUITE(test_slab_allocator)
+  {
+    //*************************************************************************
+    TEST(test_size_classes)
+    {
+      Slabs slabs;
+
+      CHECK_EQUAL(4U,  size_t(Slabs::N_CLASSES));
+      CHECK_EQUAL(64U, slabs.max_block_size());
+
+      CHECK_EQUAL(4U, slabs.available(1));
+      CHECK_EQUAL(4U, slabs.available(64));
+      CHECK_EQUAL(0U, slabs.available(65));
+
+      slabs.allocate(0);
+      slabs.allocate(1);
+      slabs.allocate(8);
+      CHECK_EQUAL(1U, slabs.available(8));
+      CHECK_EQUAL(4U, slabs.available(16));
+
+      slabs.allocate(9);
+      slabs.allocate(16);
+      CHECK_EQUAL(2U, slabs.available(16));
+      CHECK_EQUAL(4U, slabs.available(32));
+
+      slabs.allocate(17);
+      slabs.allocate(33);
+      slabs.allocate(64);
+      CHECK_EQUAL(3U, slabs.available(32));
+      CHECK_EQUAL(2U, slabs.available(64));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      Slabs slabs;
+      std::vector<char*> blocks;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        char* p = static_cast<char*>(slabs.allocate(24));
+        CHECK(slabs.is_in_pool(p));
+        std::fill(p, p + 24, char(i));
+        blocks.push_back(p);
+      }
+
+      std::sort(blocks.begin(), blocks.end());
+      CHECK(std::adjacent_find(blocks.begin(), blocks.end()) == blocks.end());
+
+      for (size_t i = 1; i < blocks.size(); ++i)
+      {
+        CHECK(size_t(blocks[i] - blocks[i - 1]) >= 32U);
+      }
+
+      CHECK_EQUAL(0U, slabs.available(24));
+
+      slabs.release(blocks[1]);
+      CHECK_EQUAL(1U, slabs.available(24));
+      CHECK(slabs.allocate(24) == blocks[1]);
+
+      int not_in_pool;
+      CHECK(!slabs.is_in_pool(&not_in_pool));
+      CHECK_THROW(slabs.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_full_class_uses_larger_class)
+    {
+      Slabs slabs;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        slabs.allocate(8);
+      }
+
+      CHECK_EQUAL(0U, slabs.available(8));
+
+      void* p = slabs.allocate(8);
+      CHECK_EQUAL(3U, slabs.available(16));
+
+      slabs.release(p);
+      CHECK_EQUAL(4U, slabs.available(16));
+
+      for (size_t i = 0; i < 12; ++i)
+      {
+        slabs.allocate(16);
+      }
+
+      CHECK_THROW(slabs.allocate(8), etl::pool_no_allocation);
+      CHECK_THROW(slabs.allocate(65), etl::pool_no_allocation);
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      Slabs slabs;
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        slabs.allocate(8);
+      }
+
+      etl::pool_statistics small = slabs.get_statistics(8);
+      etl::pool_statistics large = slabs.get_statistics(16);
+
+      CHECK_EQUAL(4U, small.allocations);
+      CHECK_EQUAL(1U, small.failures);
+      CHECK_EQUAL(4U, small.high_water);
+      CHECK_EQUAL(1U, large.allocations);
+      CHECK_EQUAL(0U, large.failures);
+
+      slabs.reset_statistics();
+      CHECK_EQUAL(0U, slabs.get_statistics(8).allocations);
+      CHECK_EQUAL(4U, slabs.get_statistics(8).high_water);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_alignment)
+    {
+      Slabs slabs;
+
+      for (size_t size = 8; size <= 64; size *= 2)
+      {
+        for (size_t i = 0; i < 4; ++i)
+        {
+          const uintptr_t address = reinterpret_cast<uintptr_t>(slabs.allocate(size));
+          const size_t    align   = std::min(size, size_t(etl::alignment_of<long double>::value));
+
+          CHECK_EQUAL(0U, address % align);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_alignment_odd_block_count)
+    {
+      etl::slab_allocator<8, 64, 3> slabs;
+
+      for (size_t size = 8; size <= 64; size *= 2)
+      {
+        for (size_t i = 0; i < 3; ++i)
+        {
+          const uintptr_t address = reinterpret_cast<uintptr_t>(slabs.allocate(size));
+          const size_t    align   = std::min(size, size_t(etl::alignment_of<long double>::value));
+
+          CHECK_EQUAL(0U, address % align);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_std_allocator)
+    {
+      etl::slab_allocator<16, 256, 16> slabs;
+
+      typedef etl::slab_std_allocator<int> Allocator;
+      typedef std::pair<const int, int>    Pair;
+
+      {
+        std::vector<int, Allocator> data((Allocator(slabs)));
+
+        for (int i = 0; i < 50; ++i)
+        {
+          data.push_back(i);
+        }
+
+        CHECK_EQUAL(50U, data.size());
+        CHECK(slabs.is_in_pool(&data[0]));
+
+        for (int i = 0; i < 50; ++i)
+        {
+          CHECK_EQUAL(i, data[i]);
+        }
+
+        std::list<int, Allocator> list((Allocator(slabs)));
+        list.push_back(1);
+        list.push_back(2);
+        list.push_front(0);
+        CHECK_EQUAL(3U, list.size());
+        CHECK(slabs.is_in_pool(&list.front()));
+
+        typedef std::map<int, int, std::less<int>, etl::slab_std_allocator<Pair> > Map;
+        Map map((Map::key_compare()), Map::allocator_type(slabs));
+
+        for (int i = 0; i < 10; ++i)
+        {
+          map[i] = i * i;
+        }
+
+        CHECK_EQUAL(81, map[9]);
+
+        CHECK(data.get_allocator() == list.get_allocator());
+        CHECK(Allocator(slabs) == etl::slab_std_allocator<Pair>(slabs));
+      }
+
+      // Everything has been returned.
+      CHECK_EQUAL(16U, slabs.available(16));
+      CHECK_EQUAL(16U, slabs.available(32));
+      CHECK_EQUAL(16U, slabs.available(64));
+      CHECK_EQUAL(16U, slabs.available(128));
+      CHECK_EQUAL(16U, slabs.available(256));
+    }
+  };
+}
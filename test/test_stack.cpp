@@ -27,6 +27,7 @@ SOFTWARE.
 #include <UnitTest++/UnitTest++.h>
 
 #include <stack>
+#include <memory>
 
 #include "../stack.h"
 
@@ -296,5 +297,22 @@ namespace
         stack2.pop();
       }
     }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::stack<Item, 4> stack;
+
+      stack.push(Item(new int(1)));
+      stack.emplace(new int(2));
+
+      CHECK_EQUAL(2U, stack.size());
+      CHECK_EQUAL(2, *stack.top());
+
+      stack.pop();
+      CHECK_EQUAL(1, *stack.top());
+    }
   };
 }
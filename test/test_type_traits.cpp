@@ -523,5 +523,34 @@ namespace
       CHECK(std::alignment_of<double>::value             == etl::alignment_of<double>::value);
       CHECK(std::alignment_of<Test>::value               == etl::alignment_of<Test>::value);
     }
+
+    //*************************************************************************
+    TEST(test_is_trivially_destructible)
+    {
+      struct NonTrivial
+      {
+        ~NonTrivial() {}
+      };
+
+      CHECK(etl::is_trivially_destructible<int>::value);
+      CHECK(etl::is_trivially_destructible<double>::value);
+      CHECK(etl::is_trivially_destructible<int*>::value);
+      CHECK(etl::is_trivially_destructible<Test>::value);
+      CHECK(!etl::is_trivially_destructible<NonTrivial>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_is_trivially_copyable)
+    {
+      struct NonTrivial
+      {
+        NonTrivial(const NonTrivial&) {}
+      };
+
+      CHECK(etl::is_trivially_copyable<int>::value);
+      CHECK(etl::is_trivially_copyable<int*>::value);
+      CHECK(etl::is_trivially_copyable<Test>::value);
+      CHECK(!etl::is_trivially_copyable<NonTrivial>::value);
+    }
   };
 }
@@ -29,11 +29,53 @@ SOFTWARE.
 #include <vector>
 #include <array>
 #include <algorithm>
+#include <memory>
+#include <string>
 
 #include "../vector.h"
 
 namespace
-{		
+{
+  //***************************************************************************
+  // Not default constructible. Counts the live instances.
+  //***************************************************************************
+  struct Counted
+  {
+    explicit Counted(int value)
+      : value(value)
+    {
+      ++live;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++live;
+    }
+
+    ~Counted()
+    {
+      --live;
+    }
+
+    Counted& operator =(const Counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    bool operator ==(const Counted& other) const
+    {
+      return value == other.value;
+    }
+
+    int value;
+
+    static int live;
+  };
+
+  int Counted::live = 0;
+
   SUITE(test_vector)
   {
     static const size_t SIZE = 10;
@@ -397,6 +439,58 @@ namespace
       CHECK_THROW(data.assign(EXCESS_SIZE, INITIAL_VALUE), etl::vector_full);
     }
 
+    //*************************************************************************
+    TEST(test_assign_range_from_self)
+    {
+      // Long enough to be held on the heap.
+      const char* strings[] = { "the first string held on the heap", "the second string held on the heap",
+                                "the third string held on the heap", "the fourth string held on the heap" };
+
+      etl::vector<std::string, 10> data(strings, strings + 4);
+
+      data.assign(data.begin() + 1, data.end());
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string(strings[1]), data[0]);
+      CHECK_EQUAL(std::string(strings[2]), data[1]);
+      CHECK_EQUAL(std::string(strings[3]), data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_range_from_self_trivially_copyable)
+    {
+      const int values[] = { 0, 1, 2, 3, 4, 5 };
+
+      etl::vector<int, 10> data(values, values + 6);
+
+      data.assign(data.begin() + 1, data.end());
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK(std::equal(values + 1, values + 6, data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_size_value_from_self)
+    {
+      // Long enough to be held on the heap.
+      const char* strings[] = { "the first string held on the heap", "the second string held on the heap",
+                                "the third string held on the heap", "the fourth string held on the heap" };
+
+      etl::vector<std::string, 10> data(strings, strings + 4);
+
+      data.assign(3, data[1]);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string(strings[1]), data[0]);
+      CHECK_EQUAL(std::string(strings[1]), data[1]);
+      CHECK_EQUAL(std::string(strings[1]), data[2]);
+
+      data.assign(6, data[2]);
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK_EQUAL(std::string(strings[1]), data[5]);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_push_back)
     {
@@ -908,5 +1002,175 @@ namespace
       CHECK(std::equal(second.begin(), second.end(), data1.begin()));
       CHECK(std::equal(first.begin(), first.end(), data2.begin()));
     }
+
+    //*************************************************************************
+    TEST(test_only_used_elements_are_constructed)
+    {
+      {
+        etl::vector<Counted, SIZE> data;
+        CHECK_EQUAL(0, Counted::live);
+
+        data.push_back(Counted(1));
+        data.push_back(Counted(2));
+        data.push_back(Counted(3));
+        CHECK_EQUAL(3, Counted::live);
+
+        data.pop_back();
+        CHECK_EQUAL(2, Counted::live);
+
+        data.insert(data.begin(), Counted(0));
+        CHECK_EQUAL(3, Counted::live);
+        CHECK_EQUAL(0, data[0].value);
+        CHECK_EQUAL(1, data[1].value);
+        CHECK_EQUAL(2, data[2].value);
+
+        data.insert(data.begin() + 1, 4, Counted(9));
+        CHECK_EQUAL(7, Counted::live);
+        CHECK_EQUAL(9, data[4].value);
+        CHECK_EQUAL(1, data[5].value);
+
+        data.erase(data.begin() + 1, data.begin() + 5);
+        CHECK_EQUAL(3, Counted::live);
+
+        data.erase(data.begin());
+        CHECK_EQUAL(2, Counted::live);
+        CHECK_EQUAL(1, data[0].value);
+
+        data.resize(5, Counted(7));
+        CHECK_EQUAL(5, Counted::live);
+
+        data.resize(1, Counted(7));
+        CHECK_EQUAL(1, Counted::live);
+
+        data.assign(3, Counted(5));
+        CHECK_EQUAL(3, Counted::live);
+
+        data.clear();
+        CHECK_EQUAL(0, Counted::live);
+
+        data.push_back(Counted(1));
+        data.push_back(Counted(2));
+      }
+
+      CHECK_EQUAL(0, Counted::live);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+      Data copy(data);
+
+      CHECK_EQUAL(data.size(), copy.size());
+      CHECK(std::equal(data.begin(), data.end(), copy.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_swap_constructs_only_used_elements)
+    {
+      {
+        etl::vector<Counted, SIZE> data1(4, Counted(1));
+        etl::vector<Counted, SIZE> data2(2, Counted(2));
+        CHECK_EQUAL(6, Counted::live);
+
+        data1.swap(data2);
+        CHECK_EQUAL(6, Counted::live);
+
+        CHECK_EQUAL(2U, data1.size());
+        CHECK_EQUAL(4U, data2.size());
+        CHECK(std::count(data1.begin(), data1.end(), Counted(2)) == 2);
+        CHECK(std::count(data2.begin(), data2.end(), Counted(1)) == 4);
+      }
+
+      CHECK_EQUAL(0, Counted::live);
+    }
+
+    //*************************************************************************
+    TEST(test_move_and_emplace)
+    {
+      typedef std::unique_ptr<int> Item;
+
+      etl::vector<Item, SIZE> data;
+
+      data.push_back(Item(new int(1)));
+      data.emplace_back(new int(3));
+      data.insert(data.begin() + 1, Item(new int(2)));
+      data.emplace(data.begin(), new int(0));
+      data.emplace(data.end(), new int(4));
+
+      CHECK_EQUAL(5U, data.size());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), *data[i]);
+      }
+
+      data.erase(data.begin() + 1);
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(0, *data[0]);
+      CHECK_EQUAL(2, *data[1]);
+      CHECK_EQUAL(4, *data[3]);
+
+      data.erase(data.begin(), data.begin() + 2);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(3, *data[0]);
+      CHECK_EQUAL(4, *data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_insert_erase_trivially_copyable)
+    {
+      struct Pod
+      {
+        int   i;
+        short s;
+      };
+
+      const Pod source[] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 4, 4 } };
+      const Pod extra[]  = { { 10, 10 }, { 11, 11 } };
+
+      etl::vector<Pod, SIZE> data(std::begin(source), std::end(source));
+      std::vector<Pod>       compare(std::begin(source), std::end(source));
+
+      data.insert(data.begin() + 2, std::begin(extra), std::end(extra));
+      compare.insert(compare.begin() + 2, std::begin(extra), std::end(extra));
+
+      data.insert(data.begin() + 1, 2, extra[1]);
+      compare.insert(compare.begin() + 1, 2, extra[1]);
+
+      data.insert(data.begin(), extra[0]);
+      compare.insert(compare.begin(), extra[0]);
+
+      data.erase(data.begin() + 3, data.begin() + 5);
+      compare.erase(compare.begin() + 3, compare.begin() + 5);
+
+      data.erase(data.begin() + 1);
+      compare.erase(compare.begin() + 1);
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i].i, data[i].i);
+        CHECK_EQUAL(compare[i].s, data[i].s);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_over_aligned_elements)
+    {
+      struct alignas(32) Over_Aligned
+      {
+        float f[8];
+      };
+
+      etl::vector<Over_Aligned, 4> data;
+
+      data.push_back(Over_Aligned());
+      data.push_back(Over_Aligned());
+
+      CHECK((size_t(&data[0]) % 32) == 0);
+      CHECK((size_t(&data[1]) % 32) == 0);
+    }
   };
 }
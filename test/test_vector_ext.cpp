@@ -0,0 +1,160 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "../vector_ext.h"
+#include "../alignment.h"
+
+namespace
+{
+  SUITE(test_vector_ext)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::vector_ext<int>                                     Data;
+    typedef etl::aligned_storage<sizeof(int) * SIZE, etl::alignment_of<int>::value>::type Buffer;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Buffer buffer;
+      Data data(&buffer, SIZE);
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.data() == reinterpret_cast<int*>(&buffer));
+    }
+
+    //*************************************************************************
+    TEST(test_elements_are_in_the_buffer)
+    {
+      int buffer[SIZE];
+      Data data(buffer, SIZE);
+
+      data.push_back(1);
+      data.push_back(2);
+      data.insert(data.begin(), 0);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, buffer[0]);
+      CHECK_EQUAL(1, buffer[1]);
+      CHECK_EQUAL(2, buffer[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_size_value)
+    {
+      int buffer[SIZE];
+      Data data(buffer, SIZE, size_t(4), 7);
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK(std::count(data.begin(), data.end(), 7) == 4);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<int> compare = { 0, 1, 2, 3, 4 };
+
+      int buffer[SIZE];
+      Data data(buffer, SIZE, compare.begin(), compare.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      int buffer[3];
+      Data data(buffer, 3);
+
+      data.push_back(0);
+      data.push_back(1);
+      data.push_back(2);
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(3), etl::vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_adopt)
+    {
+      int buffer[SIZE] = { 5, 6, 7, 8 };
+      Data data(buffer, SIZE);
+
+      data.adopt(4);
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(5, data[0]);
+      CHECK_EQUAL(8, data[3]);
+
+      Data too_big(buffer, SIZE);
+      CHECK_THROW(too_big.adopt(SIZE + 1), etl::vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment)
+    {
+      int buffer1[SIZE];
+      int buffer2[SIZE];
+
+      Data data1(buffer1, SIZE, size_t(3), 1);
+      Data data2(buffer2, SIZE);
+
+      data2 = data1;
+
+      CHECK_EQUAL(3U, data2.size());
+      CHECK(data2.data() == buffer2);
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_elements_are_destroyed)
+    {
+      typedef etl::aligned_storage<sizeof(std::string) * 4, etl::alignment_of<std::string>::value>::type StringBuffer;
+
+      StringBuffer buffer;
+
+      {
+        etl::vector_ext<std::string> data(&buffer, 4);
+
+        data.push_back(std::string(100, 'a'));
+        data.push_back(std::string(100, 'b'));
+        data.erase(data.begin());
+
+        CHECK_EQUAL(1U, data.size());
+        CHECK_EQUAL(std::string(100, 'b'), data[0]);
+      }
+    }
+  };
+}
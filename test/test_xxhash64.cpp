@@ -0,0 +1,166 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <UnitTest++/UnitTest++.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "../xxhash64.h"
+#include "../endian.h"
+
+namespace
+{
+  SUITE(test_xxhash64)
+  {
+    //*************************************************************************
+    TEST(test_xxhash64_constructor)
+    {
+      std::string data("123456789");
+
+      uint64_t hash = etl::xxhash64<>(data.begin(), data.end());
+
+      CHECK_EQUAL(0x8CB841DB40E6AE83, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_reference_values)
+    {
+      std::string empty;
+      std::string abc("abc");
+      std::string text("Nobody inspects the spammish repetition");
+
+      CHECK_EQUAL(0xEF46DB3751D8E999, etl::xxhash64<>().value());
+      CHECK_EQUAL(0x44BC2CF5AD770999, etl::xxhash64<>(abc.begin(), abc.end()).value());
+      CHECK_EQUAL(0xFBCEA83C8A378BF1, etl::xxhash64<>(text.begin(), text.end()).value());
+
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 1024; ++i)
+      {
+        data.push_back(uint8_t(i));
+      }
+
+      CHECK_EQUAL(0x6F3914F18FE4DF57, etl::xxhash64<>(data.begin(), data.end()).value());
+      CHECK_EQUAL(0x6F3914F18FE4DF57, etl::xxhash64<>(data.data(), data.data() + data.size()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_seed)
+    {
+      std::string abc("abc");
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xAC75FDA2929B17EF, etl::xxhash64<>(0x9E3779B1).value());
+      CHECK_EQUAL(0x1318DF30094A85FD, etl::xxhash64<>(abc.begin(), abc.end(), 0x9E3779B1).value());
+
+      etl::xxhash64<> xxhash64_calculator(0x9E3779B1);
+      xxhash64_calculator.add(data.begin(), data.end());
+      CHECK_EQUAL(0x6BC432BF21C3E5E2, xxhash64_calculator.value());
+
+      xxhash64_calculator.reset();
+      xxhash64_calculator.add(data.begin(), data.end());
+      CHECK_EQUAL(0x6BC432BF21C3E5E2, xxhash64_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_values)
+    {
+      std::string data("123456789");
+
+      etl::xxhash64<> xxhash64_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        xxhash64_calculator += data[i];
+      }
+
+      uint64_t hash = xxhash64_calculator;
+
+      CHECK_EQUAL(0x8CB841DB40E6AE83, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range_in_pieces)
+    {
+      std::vector<uint8_t> data;
+
+      for (int i = 0; i < 1024; ++i)
+      {
+        data.push_back(uint8_t(i));
+      }
+
+      // Split points either side of the stripe and buffer boundaries.
+      const size_t splits[] = { 0, 1, 7, 31, 32, 33, 63, 64, 100, 1023, 1024 };
+
+      for (size_t i = 0; i < (sizeof(splits) / sizeof(splits[0])); ++i)
+      {
+        for (size_t j = i; j < (sizeof(splits) / sizeof(splits[0])); ++j)
+        {
+          etl::xxhash64<> xxhash64_calculator;
+
+          xxhash64_calculator.add(data.data(),             data.data() + splits[i]);
+          xxhash64_calculator.add(data.data() + splits[i], data.data() + splits[j]);
+          xxhash64_calculator.add(data.data() + splits[j], data.data() + data.size());
+
+          CHECK_EQUAL(0x6F3914F18FE4DF57, xxhash64_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint32_t> data3 = { 0x01020304, 0x05060708 };
+
+      uint64_t hash1 = etl::xxhash64<etl::endian::little>(data1.begin(), data1.end());
+      uint64_t hash2 = etl::xxhash64<etl::endian::little>(data2.begin(), data2.end());
+      CHECK_EQUAL(hash1, hash2);
+
+      uint64_t hash3 = etl::xxhash64<etl::endian::big>(data3.begin(), data3.end());
+      CHECK_EQUAL(hash1, hash3);
+
+      uint64_t hash4 = etl::xxhash64<etl::endian::little>(data2.data(), data2.data() + data2.size());
+      CHECK_EQUAL(hash1, hash4);
+
+      uint64_t hash5 = etl::xxhash64<etl::endian::big>(data3.data(), data3.data() + data3.size());
+      CHECK_EQUAL(hash1, hash5);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range_volatile)
+    {
+      const uint32_t          data1[] = { 0x04030201, 0x08070605 };
+      volatile const uint32_t data2[] = { 0x04030201, 0x08070605 };
+
+      CHECK_EQUAL(uint64_t(etl::xxhash64<>(data1, data1 + 2)), uint64_t(etl::xxhash64<>(data2, data2 + 2)));
+    }
+  };
+}
@@ -0,0 +1,165 @@
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Prints the hash of each file named on the command line, with the time taken
+// and the throughput, so that the hash engines may be compared.
+//
+// usage: checksum_file [-e engine] [-r] file...
+//   -e  crc32 (default), crc32_c or crc64_ecma, each with an optional _slice_by_8
+//       or _hardware suffix for the table policy, fnv_1a_32, fnv_1a_64, checksum
+//       or all.
+//   -r  Read the file through a buffer instead of memory mapping it.
+//
+// Build, for example, with:
+//   g++ -O2 -DCOMPILER_GCC -DPLATFORM_LINUX -DETL_THROW_EXCEPTIONS -I.. checksum_file.cpp -o checksum_file
+//*****************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../checksum_file.h"
+#include "../crc32.h"
+#include "../crc32_c.h"
+#include "../crc64_ecma.h"
+#include "../fnv_1.h"
+#include "../checksum.h"
+
+namespace
+{
+  bool use_buffer = false;
+
+  //***************************************************************************
+  // Hashes one file with one engine and prints the result.
+  //***************************************************************************
+  template <typename THash>
+  bool run(const char* engine, const char* path)
+  {
+    static etl::align_at<uint8_t[1024 * 1024], 16> buffer;
+
+    try
+    {
+      etl::checksum_file_result<THash> result = use_buffer ? etl::checksum_file<THash>(path, buffer.value, sizeof(buffer.value))
+                                                           : etl::checksum_file<THash>(path);
+
+      printf("%-21s %0*llX %14llu bytes %10.6f s %10.1f MB/s %s  %s\n",
+             engine,
+             int(sizeof(typename THash::value_type) * 2),
+             static_cast<unsigned long long>(result.value),
+             static_cast<unsigned long long>(result.bytes),
+             result.seconds,
+             result.bytes_per_second() / (1024.0 * 1024.0),
+             result.mapped ? "mmap" : "read",
+             path);
+
+      return true;
+    }
+    catch (const etl::checksum_file_exception& e)
+    {
+      fprintf(stderr, "%s: %s\n", path, e.what());
+      return false;
+    }
+  }
+
+  const char* const ENGINES[] = { "crc32", "crc32_c", "crc64_ecma", "fnv_1a_32", "fnv_1a_64", "checksum", "all" };
+
+  bool is_engine(const char* engine)
+  {
+    for (size_t i = 0; i < sizeof(ENGINES) / sizeof(ENGINES[0]); ++i)
+    {
+      if (strcmp(engine, ENGINES[i]) == 0)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  // Hashes one file with the named engine, or all of them.
+  //***************************************************************************
+  bool run(const char* engine, const char* path)
+  {
+    bool all = (strcmp(engine, "all") == 0);
+    bool ok  = true;
+
+    if (all || (strcmp(engine, "crc32") == 0))                 { ok = run<etl::crc32<> >("crc32", path) && ok; }
+    if (all || (strcmp(engine, "crc32_slice_by_8") == 0))      { ok = run<etl::crc32<etl::endian::little, etl::crc_slice_by_8> >("crc32_slice_by_8", path) && ok; }
+    if (all || (strcmp(engine, "crc32_hardware") == 0))        { ok = run<etl::crc32<etl::endian::little, etl::crc_hardware> >("crc32_hardware", path) && ok; }
+    if (all || (strcmp(engine, "crc32_c") == 0))               { ok = run<etl::crc32_c<> >("crc32_c", path) && ok; }
+    if (all || (strcmp(engine, "crc32_c_slice_by_8") == 0))    { ok = run<etl::crc32_c<etl::endian::little, etl::crc_slice_by_8> >("crc32_c_slice_by_8", path) && ok; }
+    if (all || (strcmp(engine, "crc32_c_hardware") == 0))      { ok = run<etl::crc32_c<etl::endian::little, etl::crc_hardware> >("crc32_c_hardware", path) && ok; }
+    if (all || (strcmp(engine, "crc64_ecma") == 0))            { ok = run<etl::crc64_ecma<> >("crc64_ecma", path) && ok; }
+    if (all || (strcmp(engine, "crc64_ecma_slice_by_8") == 0)) { ok = run<etl::crc64_ecma<etl::endian::little, etl::crc_slice_by_8> >("crc64_ecma_slice_by_8", path) && ok; }
+    if (all || (strcmp(engine, "crc64_ecma_hardware") == 0))   { ok = run<etl::crc64_ecma<etl::endian::little, etl::crc_hardware> >("crc64_ecma_hardware", path) && ok; }
+    if (all || (strcmp(engine, "fnv_1a_32") == 0))             { ok = run<etl::fnv_1a_32<> >("fnv_1a_32", path) && ok; }
+    if (all || (strcmp(engine, "fnv_1a_64") == 0))             { ok = run<etl::fnv_1a_64<> >("fnv_1a_64", path) && ok; }
+    if (all || (strcmp(engine, "checksum") == 0))              { ok = run<etl::checksum<uint32_t> >("checksum", path) && ok; }
+
+    return ok;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* engine = "crc32";
+  bool ok    = true;
+  int  files = 0;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "-e") == 0) && (i + 1 < argc))
+    {
+      engine = argv[++i];
+
+      if (!is_engine(engine))
+      {
+        fprintf(stderr, "unknown engine '%s'\n", engine);
+        return 2;
+      }
+    }
+    else if (strcmp(argv[i], "-r") == 0)
+    {
+      use_buffer = true;
+    }
+    else
+    {
+      ok = run(engine, argv[i]) && ok;
+      ++files;
+    }
+  }
+
+  if (files == 0)
+  {
+    fprintf(stderr, "usage: checksum_file [-e crc32|crc32_c|crc64_ecma|fnv_1a_32|fnv_1a_64|checksum|all] [-r] file...\n");
+    return 2;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -32,6 +32,11 @@ SOFTWARE.
 #include <stddef.h>
 
 #include "nullptr.h"
+#include "platform.h"
+
+#if defined(ETL_CPP11_SUPPORTED)
+#include <type_traits>
+#endif
 
 ///\defgroup type_traits type_traits
 /// A set of type traits definitions for compilers that do not support the standard header.
@@ -231,6 +236,26 @@ namespace etl
   template <typename T> struct is_reference : false_type {};
   template <typename T> struct is_reference<T&> : true_type {};
 
+  /// is_trivially_destructible
+  /// Without compiler support only fundamental and pointer types are
+  /// reported as trivially destructible.
+  ///\ingroup type_traits
+#if defined(ETL_CPP11_SUPPORTED)
+  template <typename T> struct is_trivially_destructible : integral_constant<bool, std::is_trivially_destructible<T>::value> {};
+#else
+  template <typename T> struct is_trivially_destructible : integral_constant<bool, is_fundamental<T>::value || is_pointer<T>::value> {};
+#endif
+
+  /// is_trivially_copyable
+  /// Without compiler support only fundamental and pointer types are
+  /// reported as trivially copyable.
+  ///\ingroup type_traits
+#if defined(ETL_CPP11_SUPPORTED)
+  template <typename T> struct is_trivially_copyable : integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+#else
+  template <typename T> struct is_trivially_copyable : integral_constant<bool, is_fundamental<T>::value || is_pointer<T>::value> {};
+#endif
+
   /// make_signed
   ///\ingroup type_traits
   template <typename T> struct make_signed { typedef  T type; };
@@ -34,11 +34,12 @@ SOFTWARE.
 
 #include "ivector.h"
 #include "container.h"
+#include "alignment.h"
 
 //*****************************************************************************
 ///\defgroup vector vector
 /// A vector with the capacity defined at compile time.
-///\note Uses a predefined array, so MAX_SIZE_ elements will be always be constructed.
+///\note Uses uninitialised storage, so only the elements in use are ever constructed.
 ///\ingroup containers
 //*****************************************************************************
 
@@ -47,7 +48,7 @@ namespace etl
   template <typename T, const size_t MAX_SIZE_>
   //***************************************************************************
   /// A vector implementation that uses a fixed size buffer.
-  ///\note Uses a predefined array, so MAX_SIZE_ elements will be always be constructed.
+  ///\note Uses uninitialised storage, so only the elements in use are ever constructed.
   ///\tparam T The element type.
   ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
   ///\ingroup vector
@@ -62,7 +63,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     vector()
-      : ivector<T>(buffer, MAX_SIZE)
+      : ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
     {
     }
 
@@ -71,7 +72,7 @@ namespace etl
     ///\param initialSize The initial size of the vector.
     //*************************************************************************
     explicit vector(size_t initialSize)
-      : ivector<T>(buffer, MAX_SIZE)
+      : ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
     {
       ivector<T>::resize(initialSize);
     }
@@ -82,7 +83,7 @@ namespace etl
     ///\param value        The value to fill the vector with.
     //*************************************************************************
     vector(size_t initialSize, typename ivector<T>::parameter_t value)
-      :  ivector<T>(buffer, MAX_SIZE)
+      :  ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
     {
       ivector<T>::resize(initialSize, value);
     }
@@ -95,33 +96,62 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     vector(TIterator first, TIterator last)
-      :  ivector<T>(buffer, MAX_SIZE)
+      :  ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
     {
       ivector<T>::assign(first, last);
     }
 
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    vector(const vector& other)
+      : ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      ivector<T>::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~vector()
+    {
+      ivector<T>::clear();
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
     vector& operator = (const vector& rhs)
     {
-      ivector<T>::assign(rhs.cbegin(), rhs.cend());
+      if (&rhs != this)
+      {
+        ivector<T>::assign(rhs.cbegin(), rhs.cend());
+      }
 
       return *this;
     }
 
     //*************************************************************************
     /// Swap
+    /// Only the elements in use are swapped. The excess elements of the larger
+    /// vector are copied to the smaller one and then destroyed.
     //*************************************************************************
     void swap(vector& other)
     {
-      std::swap_ranges(etl::begin(buffer), etl::end(buffer), etl::begin(other.buffer));
-      std::swap(this->current_size, other.current_size);
+      vector& smaller = (this->size() < other.size()) ? *this : other;
+      vector& larger  = (this->size() < other.size()) ? other : *this;
+
+      std::swap_ranges(smaller.begin(), smaller.end(), larger.begin());
+
+      typename ivector<T>::iterator excess = larger.begin() + smaller.size();
+      smaller.insert(smaller.end(), excess, larger.end());
+      larger.erase(excess, larger.end());
     }
 
   private:
 
-    T buffer[MAX_SIZE]; ///<The array that stores the elements.
+    /// The uninitialised storage for the elements.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE, etl::alignment_of<T>::value>::type buffer;
   };
 
   //*************************************************************************
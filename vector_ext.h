@@ -0,0 +1,155 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_VECTOR_EXT__
+#define __ETL_VECTOR_EXT__
+
+#include <stddef.h>
+#include <iterator>
+
+#include "ivector.h"
+
+#ifndef ETL_THROW_EXCEPTIONS
+#include "error_handler.h"
+#endif
+
+//*****************************************************************************
+///\defgroup vector_ext vector_ext
+/// A vector that uses a buffer supplied at run time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A vector implementation that uses a buffer supplied by the caller, such
+  /// as a static array, shared memory or a memory mapped file.
+  /// The buffer must be suitably aligned for T and hold at least 'max_size' elements.
+  /// The buffer must outlive the vector.
+  ///\note Only the elements in use are ever constructed.
+  ///\tparam T The element type.
+  ///\ingroup vector_ext
+  //***************************************************************************
+  template <typename T>
+  class vector_ext : public ivector<T>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer for the elements.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    //*************************************************************************
+    vector_ext(void* buffer, size_t max_size)
+      : ivector<T>(static_cast<T*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param buffer      The buffer for the elements.
+    ///\param max_size    The maximum number of elements that the buffer can hold.
+    ///\param initialSize The initial size of the vector.
+    ///\param value       The value to fill the vector with.
+    //*************************************************************************
+    vector_ext(void* buffer, size_t max_size, size_t initialSize, typename ivector<T>::parameter_t value)
+      : ivector<T>(static_cast<T*>(buffer), max_size)
+    {
+      ivector<T>::resize(initialSize, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param buffer   The buffer for the elements.
+    ///\param max_size The maximum number of elements that the buffer can hold.
+    ///\param first    The iterator to the first element.
+    ///\param last     The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    vector_ext(void* buffer, size_t max_size, TIterator first, TIterator last)
+      : ivector<T>(static_cast<T*>(buffer), max_size)
+    {
+      ivector<T>::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Destroys the elements. The buffer itself is left to the caller.
+    //*************************************************************************
+    ~vector_ext()
+    {
+      ivector<T>::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// Copies the elements. Each vector keeps its own buffer.
+    //*************************************************************************
+    vector_ext& operator = (const vector_ext& rhs)
+    {
+      if (&rhs != this)
+      {
+        ivector<T>::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adopts the first 'size' elements already in the buffer, without
+    /// constructing or copying them. Used to reattach to the contents of a
+    /// persistent mapping or shared memory. Intended for an empty vector;
+    /// any elements already in use are taken over as they are.
+    /// If ETL_THROW_EXCEPTIONS is defined, emits vector_full if 'size' is larger than the maximum.
+    ///\param size The number of valid elements at the start of the buffer.
+    //*************************************************************************
+    void adopt(size_t size)
+    {
+      if (size > this->MAX_SIZE)
+      {
+#ifdef ETL_THROW_EXCEPTIONS
+        throw vector_full();
+#else
+        error_handler::error(vector_full());
+#endif
+      }
+      else
+      {
+        this->current_size = size;
+      }
+    }
+
+  private:
+
+    // Disabled. There is no buffer to copy in to.
+    vector_ext(const vector_ext&);
+  };
+}
+
+#endif
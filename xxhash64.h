@@ -0,0 +1,369 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef __ETL_XXHASH64__
+#define __ETL_XXHASH64__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "static_assert.h"
+#include "type_traits.h"
+#include "endian.h"
+#include "hash_input.h"
+
+///\defgroup xxhash64 xxHash 64 bit hash calculation
+/// An implementation of the XXH64 algorithm by Yann Collet.
+/// Input is consumed in 32 byte stripes by four independent lanes, so it is
+/// many times faster than a byte at a time hash on long keys.
+/// The results match the reference XXH64 for the same seed.
+///\ingroup maths
+
+namespace etl
+{
+  namespace __private_xxhash64__
+  {
+    static const uint64_t PRIME1 = 0x9E3779B185EBCA87;
+    static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4F;
+    static const uint64_t PRIME3 = 0x165667B19E3779F9;
+    static const uint64_t PRIME4 = 0x85EBCA77C2B2AE63;
+    static const uint64_t PRIME5 = 0x27D4EB2F165667C5;
+
+    inline uint64_t rotl(uint64_t value, int bits)
+    {
+      return (value << bits) | (value >> (64 - bits));
+    }
+
+    //*************************************************************************
+    /// Reads a little endian value, whatever the byte order of the host.
+    /// Compilers reduce this to a single load on little endian targets.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+      return  uint64_t(p[0])        | (uint64_t(p[1]) << 8)  | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+             (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
+
+    inline uint32_t read32(const uint8_t* p)
+    {
+      return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    inline uint64_t lane_round(uint64_t lane, uint64_t input)
+    {
+      lane += input * PRIME2;
+      lane  = rotl(lane, 31);
+      return lane * PRIME1;
+    }
+
+    inline uint64_t merge_round(uint64_t hash, uint64_t lane)
+    {
+      hash ^= lane_round(0, lane);
+      return (hash * PRIME1) + PRIME4;
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the xxhash64 hash.
+  ///\tparam ENDIANNESS The endianness of the calculation for input types larger than uint8_t. Default = endian::little.
+  ///\ingroup xxhash64
+  //***************************************************************************
+  template <const int ENDIANNESS = endian::little>
+  class xxhash64
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param seed The seed. Default = 0.
+    //*************************************************************************
+    explicit xxhash64(uint64_t seed = 0)
+      : seed(seed)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end)
+      : seed(0)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Constructor from range, with a seed.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, uint64_t seed)
+      : seed(seed)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      using namespace __private_xxhash64__;
+
+      lane[0]       = seed + PRIME1 + PRIME2;
+      lane[1]       = seed + PRIME2;
+      lane[2]       = seed;
+      lane[3]       = seed - PRIME1;
+      total_length  = 0;
+      buffer_length = 0;
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the xxhash64.
+    //*************************************************************************
+    template<typename TValue>
+    void add(TValue value)
+    {
+      STATIC_ASSERT(is_integral<TValue>::value, "Non-integral parameter");
+
+      uint8_t bytes[sizeof(TValue)];
+      __private_hash_input__::to_bytes<ENDIANNESS>(value, bytes);
+
+      add_bytes(bytes, bytes + sizeof(TValue));
+    }
+
+    //*************************************************************************
+    /// \param value The char to add to the xxhash64.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      buffer[buffer_length++] = value;
+      ++total_length;
+
+      if (buffer_length == STRIPE_LENGTH)
+      {
+        add_stripe(buffer);
+        buffer_length = 0;
+      }
+    }
+
+    //*************************************************************************
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      add_range(begin, end, typename __private_hash_input__::is_integral_pointer<TIterator>::type());
+    }
+
+    //*************************************************************************
+    /// Gets the xxhash64 value.
+    /// More data may be added afterwards.
+    //*************************************************************************
+    value_type value() const
+    {
+      using namespace __private_xxhash64__;
+
+      uint64_t hash;
+
+      if (total_length >= STRIPE_LENGTH)
+      {
+        hash = rotl(lane[0], 1) + rotl(lane[1], 7) + rotl(lane[2], 12) + rotl(lane[3], 18);
+        hash = merge_round(hash, lane[0]);
+        hash = merge_round(hash, lane[1]);
+        hash = merge_round(hash, lane[2]);
+        hash = merge_round(hash, lane[3]);
+      }
+      else
+      {
+        hash = seed + PRIME5;
+      }
+
+      hash += total_length;
+
+      const uint8_t* p   = buffer;
+      const uint8_t* end = buffer + buffer_length;
+
+      while ((end - p) >= 8)
+      {
+        hash ^= lane_round(0, read64(p));
+        hash  = (rotl(hash, 27) * PRIME1) + PRIME4;
+        p += 8;
+      }
+
+      if ((end - p) >= 4)
+      {
+        hash ^= uint64_t(read32(p)) * PRIME1;
+        hash  = (rotl(hash, 23) * PRIME2) + PRIME3;
+        p += 4;
+      }
+
+      while (p != end)
+      {
+        hash ^= (*p++) * PRIME5;
+        hash  = rotl(hash, 11) * PRIME1;
+      }
+
+      hash ^= hash >> 33;
+      hash *= PRIME2;
+      hash ^= hash >> 29;
+      hash *= PRIME3;
+      hash ^= hash >> 32;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// \param value The value to add to the xxhash64.
+    //*************************************************************************
+    template<typename TValue>
+    xxhash64<ENDIANNESS>& operator +=(TValue value)
+    {
+      add(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    static const size_t STRIPE_LENGTH = 32;
+
+    //*************************************************************************
+    /// Adds a 32 byte stripe to the lanes.
+    //*************************************************************************
+    void add_stripe(const uint8_t* p)
+    {
+      using namespace __private_xxhash64__;
+
+      lane[0] = lane_round(lane[0], read64(p));
+      lane[1] = lane_round(lane[1], read64(p + 8));
+      lane[2] = lane_round(lane[2], read64(p + 16));
+      lane[3] = lane_round(lane[3], read64(p + 24));
+    }
+
+    //*************************************************************************
+    /// Adds a range of bytes.
+    /// Whole stripes are read in place; only the ends pass through the buffer.
+    //*************************************************************************
+    void add_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      // Complete a partly filled buffer.
+      while ((buffer_length != 0) && (begin != end))
+      {
+        add(*begin++);
+      }
+
+      total_length += uint64_t(end - begin);
+
+      if ((end - begin) >= ptrdiff_t(STRIPE_LENGTH))
+      {
+        using namespace __private_xxhash64__;
+
+        // Local copies of the lanes let the compiler keep them in registers.
+        uint64_t lane0 = lane[0];
+        uint64_t lane1 = lane[1];
+        uint64_t lane2 = lane[2];
+        uint64_t lane3 = lane[3];
+
+        do
+        {
+          lane0 = lane_round(lane0, read64(begin));
+          lane1 = lane_round(lane1, read64(begin + 8));
+          lane2 = lane_round(lane2, read64(begin + 16));
+          lane3 = lane_round(lane3, read64(begin + 24));
+          begin += STRIPE_LENGTH;
+        } while ((end - begin) >= ptrdiff_t(STRIPE_LENGTH));
+
+        lane[0] = lane0;
+        lane[1] = lane1;
+        lane[2] = lane2;
+        lane[3] = lane3;
+      }
+
+      while (begin != end)
+      {
+        buffer[buffer_length++] = *begin++;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of integral values in contiguous memory.
+    /// They are read as bytes if their memory order matches ENDIANNESS.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, true_type)
+    {
+      if ((sizeof(*begin) == 1) || __private_hash_input__::is_memory_order<ENDIANNESS>())
+      {
+        add_bytes(reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+      }
+      else
+      {
+        add_range(begin, end, false_type());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of values, one at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, false_type)
+    {
+      while (begin != end)
+      {
+        add(*begin++);
+      }
+    }
+
+    uint64_t seed;
+    uint64_t lane[4];
+    uint64_t total_length;
+    uint8_t  buffer[STRIPE_LENGTH];
+    size_t   buffer_length;
+  };
+}
+
+#endif